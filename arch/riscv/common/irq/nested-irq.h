@@ -0,0 +1,178 @@
+/***************************************************************************//**
+  * @file     nested-irq.h
+  * @brief    Nested machine interrupt wrappers
+  * @details  Opt in per handler preemption, save trap state, mask the handlers own cause and turn MIE back on.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __NESTED_IRQ_H
+#define __NESTED_IRQ_H
+
+#include <stdint.h>
+
+#include "riscv-csr.h"
+
+/**
+ * @def NESTED_IRQ_MAX_HARTS
+ * harts with their own nesting depth, a power of 2. Same as
+ * SMP_MAX_HARTS, harts past it stay parked and take no traps.
+ */
+#define NESTED_IRQ_MAX_HARTS  8
+
+/**
+ * @brief NESTED_IRQ handlers running with interrupts back
+ * on, per mhartid, defined in vector-table.c. Only the hart
+ * itself writes its slot, a trap that nests on it puts the
+ * count back before returning, so no atomics are needed.
+ */
+extern volatile uint32_t g_nested_irq_depth[NESTED_IRQ_MAX_HARTS];
+
+/*********************************************//**
+  * @brief nesting depth of the calling hart.
+  *
+  * @return pointer to the slot of this hart.
+  *************************************************/
+static inline volatile uint32_t *nestedIrqDepth(void)
+{
+  return &g_nested_irq_depth[csr_read_mhartid() & (NESTED_IRQ_MAX_HARTS - 1)];
+}
+
+/**
+ * @struct s_nested_irq
+ * @brief trap state saved by NESTED_IRQ_ENTER, a nested trap overwrites it.
+ */
+struct s_nested_irq
+{
+  /**
+  * @var s_nested_irq::mepc
+  * return address of the interrupted code
+  */
+  uint_xlen_t mepc;
+  /**
+  * @var s_nested_irq::mstatus
+  * mstatus with MPIE/MPP for the mret
+  */
+  uint_xlen_t mstatus;
+  /**
+  * @var s_nested_irq::mie
+  * enable bits that were masked on entry
+  */
+  uint_xlen_t mie;
+};
+
+/*********************************************//**
+  * @brief save trap state, mask the causes in mask and
+  * enable interrupts. Must be first in the handler.
+  *
+  * @param mask mie bits to keep off while nested, at
+  * least the handlers own cause (MIE_MTI_BIT_MASK ...)
+  * since it is still pending until the handler clears it.
+  *************************************************/
+#define NESTED_IRQ_ENTER(mask) \
+  struct s_nested_irq __nested_irq; \
+  enterNestedIrq(&__nested_irq, (mask))
+
+/*********************************************//**
+  * @brief disable interrupts and restore trap state
+  * saved by NESTED_IRQ_ENTER. Must be last in the handler.
+  *************************************************/
+#define NESTED_IRQ_EXIT() \
+  exitNestedIrq(&__nested_irq)
+
+/*********************************************//**
+  * @brief define a preemptible vector table handler.
+  *
+  * NESTED_IRQ_HANDLER(riscv_mtvec_mti, MIE_MTI_BIT_MASK)
+  * {
+  *   serviceClintTimer();
+  * }
+  *
+  * @param name vector table handler (riscv_mtvec_mti ...)
+  * @param mask mie bits to keep off while nested.
+  *************************************************/
+#define NESTED_IRQ_HANDLER(name, mask) \
+  static void name##_nested(void); \
+  void name(void) \
+  { \
+    NESTED_IRQ_ENTER(mask); \
+    name##_nested(); \
+    NESTED_IRQ_EXIT(); \
+  } \
+  static void name##_nested(void)
+
+/*********************************************//**
+  * @brief save trap state and enable interrupts, use NESTED_IRQ_ENTER.
+  *
+  * @param p_nested storage on the handlers stack
+  * @param mask mie bits to keep off while nested.
+  *************************************************/
+static inline void enterNestedIrq(struct s_nested_irq *p_nested, uint_xlen_t mask)
+{
+  p_nested->mepc    = csr_read_mepc();
+  p_nested->mstatus = csr_read_mstatus();
+  p_nested->mie     = csr_read_clr_bits_mie(mask) & mask;
+
+  // counted before MIE is on, so anything the handler calls sees it.
+  (*nestedIrqDepth())++;
+
+  csr_set_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+}
+
+/*********************************************//**
+  * @brief disable interrupts and restore trap state, use NESTED_IRQ_EXIT.
+  *
+  * @param p_nested storage from enterNestedIrq
+  *************************************************/
+static inline void exitNestedIrq(struct s_nested_irq *p_nested)
+{
+  csr_clr_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+
+  (*nestedIrqDepth())--;
+
+  // only put back what was masked, a nested handler may have changed the rest.
+  csr_set_bits_mie(p_nested->mie);
+
+  csr_write_mepc(p_nested->mepc);
+  csr_write_mstatus(p_nested->mstatus);
+}
+
+/*********************************************//**
+  * @brief check for a NESTED_IRQ handler in progress.
+  * Interrupts are on inside them, so mstatus.MIE alone
+  * does not tell a handler from normal code.
+  *
+  * @return number of nested handlers running on the
+  * calling hart, 0 outside.
+  *************************************************/
+static inline uint32_t getNestedIrqDepth(void)
+{
+  return *nestedIrqDepth();
+}
+
+#endif
@@ -17,8 +17,12 @@
 #include <stdint.h>
 
 #include "vector-table.h"
+#include "nested-irq.h"
 #include "riscv-csr.h"
 
+// NESTED_IRQ_ENTER/NESTED_IRQ_EXIT keep count, see nested-irq.h.
+volatile uint32_t g_nested_irq_depth[NESTED_IRQ_MAX_HARTS] = {0};
+
 void init_machine_irq()
 {
   // copy pasta from vector example
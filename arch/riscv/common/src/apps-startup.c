@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include <string.h>
+#include <base.h>
 #include "global_pointers.h"
 
 // Generic C function pointer.
@@ -24,6 +25,13 @@ extern const uint8_t metal_segment_itim_source_start;
 extern uint8_t metal_segment_itim_target_start;
 extern uint8_t metal_segment_itim_target_end;
 
+// Thread local storage image and the per hart blocks
+extern const uint8_t __tdata_source;
+extern uint8_t __tdata_size;
+extern uint8_t __tls_size;
+extern uint8_t __tls_stride;
+extern uint8_t __tls_harts;
+
 extern function_t __init_array_start;
 extern function_t __init_array_end;
 extern function_t __fini_array_start;
@@ -35,20 +43,32 @@ extern void _enter(void)  __attribute__ ((naked, section(".text.metal.init.enter
 
 // Entry and exit points as C functions.
 extern void _start(void) __attribute__ ((noreturn));
+extern void _start_secondary(void) __attribute__ ((noreturn));
 void _Exit(int exit_code) __attribute__ ((noreturn,noinline));
 
 // Standard entry point, no arguments.
 extern int main(void);
 extern void __attribute__((constructor)) dev_init(void);
 
+// Parks a secondary hart until startSmpHart, smp.c
+extern void runSmpHart(void) __attribute__ ((noreturn));
+
 // The linker script will place this in the reset entry point.
 // It will be 'called' with no stack or C runtime configuration.
-// NOTE - this only supports a single hart.
-// tp will not be initialized
+// Every hart gets its own stack below _sp, hart 0 runs the C runtime
+// and main, the others go to _start_secondary and park. Harts at or
+// above __num_harts never leave the wfi loop.
 void _enter(void) {
     // Setup SP and GP
     // The locations are defined in the linker script
     __asm__ volatile  (
+        "csrr  t0, mhartid;"
+        "la    t1, __num_harts;"
+        "bltu  t0, t1, 2f;"
+        "1:;"
+        "wfi;"
+        "j     1b;"
+        "2:;"
         ".option push;"
         // The 'norelax' option is critical here.
         // Without 'norelax' the global pointer will
@@ -57,7 +77,14 @@ void _enter(void) {
         "la    gp, __global_pointer$;"
         ".option pop;"
         "la    sp, _sp;"
+        "la    t1, __stack_size;"
+        "mul   t1, t1, t0;"
+        "sub   sp, sp, t1;"
+        "bnez  t0, 3f;"
+        "la    tp, __tls_base;"
         "jal   zero, _start;"
+        "3:;"
+        "jal   zero, _start_secondary;"
         "nop;"
         "nop;"
         "nop;"
@@ -110,9 +137,34 @@ void _start(void) {
     _Exit(rc);
 }
 
+// Secondary harts, stack is set but nothing else. Only touch the
+// hart's own TLS block, hart 0 is still clearing .bss.
+void _start_secondary(void) {
+    uint32_t hart = 0;
+    uint8_t *p_tls = NULL;
+
+    __asm__ volatile ("csrr %0, mhartid" : "=r"(hart));
+
+    p_tls = &__tls_harts + (hart - 1) * (uint32_t)&__tls_stride;
+
+    // Initialize the thread local storage (.tdata copy, .tbss zero)
+    memcpy(p_tls, &__tdata_source, (uint32_t)&__tdata_size);
+
+    memset(p_tls + (uint32_t)&__tdata_size, 0, (uint32_t)&__tls_size - (uint32_t)&__tdata_size);
+
+    __asm__ volatile ("mv tp, %0" : : "r"(p_tls));
+
+    runSmpHart();
+}
+
 // This should never be called. Busy loop with the CPU in idle state.
+// Under qemu the test device ends the run with the exit code instead.
 void _Exit(int exit_code) {
+#ifdef SIFIVE_TEST_ADDR
+    *(volatile uint32_t *)SIFIVE_TEST_ADDR = (exit_code ? (((uint32_t)exit_code << 16) | SIFIVE_TEST_FAIL) : SIFIVE_TEST_PASS);
+#else
     (void)exit_code;
+#endif
     // Halt
     while (1) {
         __asm__ volatile ("wfi");
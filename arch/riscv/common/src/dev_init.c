@@ -31,13 +31,54 @@
   *****************************************************************************/
 #include <base.h>
 #include <uart.h>
+#include <clint.h>
 #include "global_pointers.h"
 
 struct s_uart *__gp_uart;
+struct s_clint *__gp_clint;
+
+uint32_t __cpu_cycles_per_us = CPU_CYCLES_PER_US;
+
+// count cycles over 100 us of mtime.
+#define CALIBRATE_US    100
+#define CALIBRATE_TICKS ((BUS_FREQ_HZ/1000000) * CALIBRATE_US)
+
+// measure mcycle against mtime so delays track the real clock.
+static void calibrate_delay(struct s_clint *p_clint)
+{
+  uint32_t start;
+  uint32_t cycles;
+  uint64_t mtime;
+
+  // line up on a tick edge
+  mtime = getClintMTime(p_clint);
+
+  while(getClintMTime(p_clint) == mtime);
+
+  start = __cycles();
+
+  mtime = getClintMTime(p_clint) + CALIBRATE_TICKS;
+
+  while(getClintMTime(p_clint) < mtime);
+
+  cycles = __cycles() - start;
+
+  // rounded, truncating would make every delay short.
+  cycles = (cycles + CALIBRATE_US/2) / CALIBRATE_US;
+
+  // keep the compile time value if mcycle is stuck or way off.
+  if((cycles < CPU_CYCLES_PER_US/2) || (cycles > CPU_CYCLES_PER_US*2)) return;
+
+  __cpu_cycles_per_us = cycles;
+}
 
 void __attribute__((constructor)) dev_init(void)
 {
-  __gp_uart = (struct s_uart *)UART_ADDR;
+  __gp_uart = initUart(UART_ADDR);
+  
+  __gp_clint = initClint(CLINT_ADDR);
+  
+  calibrate_delay(__gp_clint);
   
   setUartResetTXfifo(__gp_uart);
   
@@ -30,5 +30,7 @@
   *****************************************************************************/
 #include <stddef.h>
 #include <uart.h>
+#include <clint.h>
 
 extern struct s_uart *__gp_uart;
+extern struct s_clint *__gp_clint;
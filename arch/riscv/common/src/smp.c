@@ -0,0 +1,192 @@
+/***************************************************************************//**
+  * @file     smp.c
+  * @brief    Multi hart runtime
+  * @details  Release parked secondary harts to run an entry function, spin locks for sharing data between them.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stddef.h>
+
+#include <riscv-csr.h>
+
+#include "smp.h"
+
+// linker script hart count, the value is the symbol address
+extern uint8_t __num_harts;
+
+/**
+ * @struct s_smp_hart
+ * @brief secondary hart state
+ */
+struct s_smp_hart
+{
+  smp_entry entry;
+  void *p_arg;
+  volatile uint32_t running;
+};
+
+static struct
+{
+  struct s_clint *p_clint;
+  struct s_smp_hart harts[SMP_MAX_HARTS];
+} g_smp;
+
+// get the hart id of the caller
+uint32_t getSmpHartId(void)
+{
+  return csr_read_mhartid();
+}
+
+// number of harts started by _enter
+uint32_t getSmpNumHarts(void)
+{
+  uint32_t num = (uint32_t)&__num_harts;
+
+  return (num < SMP_MAX_HARTS ? num : SMP_MAX_HARTS);
+}
+
+// release a parked secondary hart
+int startSmpHart(struct s_clint *p_clint, uint32_t hart, smp_entry entry, void *p_arg)
+{
+  struct s_smp_hart *p_hart = NULL;
+
+  if(!p_clint) return 1;
+
+  if(!entry) return 1;
+
+  if(!hart || (hart >= getSmpNumHarts())) return 1;
+
+  p_hart = &g_smp.harts[hart];
+
+  if(p_hart->running) return 1;
+
+  g_smp.p_clint  = p_clint;
+  p_hart->entry   = entry;
+  p_hart->p_arg   = p_arg;
+  p_hart->running = 1;
+
+  // everything above is visible before the hart can wake.
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  setClintMsipHart(p_clint, hart);
+
+  return 0;
+}
+
+// check if a secondary hart is still running its entry
+int isSmpHartRunning(uint32_t hart)
+{
+  if(hart >= SMP_MAX_HARTS) return 0;
+
+  return g_smp.harts[hart].running;
+}
+
+// spin until a secondary hart is parked
+void waitSmpHart(uint32_t hart)
+{
+  while(isSmpHartRunning(hart));
+
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
+
+// spin until the lock is held
+void lockSmp(struct s_smp_lock *p_lock)
+{
+  if(!p_lock) return;
+
+  while(tryLockSmp(p_lock))
+  {
+    // wait on a plain load, the amoswap would keep the line busy.
+    while(p_lock->lock);
+  }
+}
+
+// take the lock if it is free
+int tryLockSmp(struct s_smp_lock *p_lock)
+{
+  if(!p_lock) return 1;
+
+  return (int)__atomic_exchange_n(&p_lock->lock, 1, __ATOMIC_ACQUIRE);
+}
+
+// release the lock
+void unlockSmp(struct s_smp_lock *p_lock)
+{
+  if(!p_lock) return;
+
+  __atomic_store_n(&p_lock->lock, 0, __ATOMIC_RELEASE);
+}
+
+// park loop of a secondary hart
+void runSmpHart(void)
+{
+  uint32_t hart = csr_read_mhartid();
+
+  smp_entry entry = NULL;
+  struct s_smp_hart *p_hart = NULL;
+
+  // no state for it, startSmpHart will never release it.
+  while(hart >= SMP_MAX_HARTS)
+  {
+    __asm__ volatile ("wfi");
+  }
+
+  for(;;)
+  {
+    // msip is the only wake up, mstatus.MIE stays off so it never traps.
+    csr_clr_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+    csr_write_mie(MIE_MSI_BIT_MASK);
+
+    while(!(csr_read_mip() & MIP_MSI_BIT_MASK))
+    {
+      __asm__ volatile ("wfi");
+    }
+
+    // hart 0 only raises msip after .bss is cleared and g_smp is set.
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    clrClintMsipHart(g_smp.p_clint, hart);
+
+    p_hart = &g_smp.harts[hart];
+
+    entry = p_hart->entry;
+
+    if(!entry || !p_hart->running) continue;
+
+    entry(p_hart->p_arg);
+
+    csr_clr_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+
+    p_hart->entry = NULL;
+
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    p_hart->running = 0;
+  }
+}
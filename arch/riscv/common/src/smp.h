@@ -0,0 +1,149 @@
+/***************************************************************************//**
+  * @file     smp.h
+  * @brief    Multi hart runtime
+  * @details  Release parked secondary harts to run an entry function, spin locks for sharing data between them.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __SMP_H
+#define __SMP_H
+
+#include <stdint.h>
+
+#include <clint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def SMP_MAX_HARTS
+ * harts the runtime keeps state for, hart ids above are parked for good.
+ * NESTED_IRQ_MAX_HARTS in irq/nested-irq.h has to match.
+ */
+#define SMP_MAX_HARTS   8
+
+/**
+ * @typedef smp_entry
+ * @brief function a secondary hart runs, the hart parks again when it returns.
+ */
+typedef void (*smp_entry)(void *p_arg);
+
+/**
+ * @struct s_smp_lock
+ * @brief spin lock, zero is unlocked.
+ */
+struct s_smp_lock
+{
+  /**
+  * @var s_smp_lock::lock
+  * 1 when held
+  */
+  volatile uint32_t lock;
+};
+
+/*********************************************//**
+  * @brief get the hart id of the caller
+  *
+  * @return mhartid
+  *************************************************/
+uint32_t getSmpHartId(void);
+
+/*********************************************//**
+  * @brief number of harts started by _enter, the
+  * __num_harts linker symbol.
+  *
+  * @return number of harts
+  *************************************************/
+uint32_t getSmpNumHarts(void);
+
+/*********************************************//**
+  * @brief release a parked secondary hart with its msip.
+  * The hart runs entry on its own stack and TLS with
+  * interrupts off, it must set up mtvec itself
+  * (init_machine_irq) to take any.
+  *
+  * @param p_clint pointer to clint struct
+  * @param hart mhartid to start, not 0
+  * @param entry function to run
+  * @param p_arg passed to entry
+  *
+  * @return 0 on success, 1 if the hart does not exist or is running.
+  *************************************************/
+int startSmpHart(struct s_clint *p_clint, uint32_t hart, smp_entry entry, void *p_arg);
+
+/*********************************************//**
+  * @brief check if a secondary hart is still running its entry
+  *
+  * @param hart mhartid
+  *
+  * @return 1 if running
+  *************************************************/
+int isSmpHartRunning(uint32_t hart);
+
+/*********************************************//**
+  * @brief spin until a secondary hart is parked
+  *
+  * @param hart mhartid
+  *************************************************/
+void waitSmpHart(uint32_t hart);
+
+/*********************************************//**
+  * @brief spin until the lock is held
+  *
+  * @param p_lock lock to take
+  *************************************************/
+void lockSmp(struct s_smp_lock *p_lock);
+
+/*********************************************//**
+  * @brief take the lock if it is free
+  *
+  * @param p_lock lock to take
+  *
+  * @return 0 if the lock is now held
+  *************************************************/
+int tryLockSmp(struct s_smp_lock *p_lock);
+
+/*********************************************//**
+  * @brief release the lock
+  *
+  * @param p_lock lock to release
+  *************************************************/
+void unlockSmp(struct s_smp_lock *p_lock);
+
+/*********************************************//**
+  * @brief park loop of a secondary hart, called by _start_secondary.
+  *************************************************/
+void runSmpHart(void) __attribute__ ((noreturn));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
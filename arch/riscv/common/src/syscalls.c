@@ -32,8 +32,32 @@
 
 #include <sys/stat.h> 
 #include <sys/types.h>
+#include <stddef.h>
+#include <base.h>
+#include <riscv-csr.h>
 #include <uart.h>
+#include <clint_timer.h>
 #include "global_pointers.h"
+#include "syscalls.h"
+
+// recheck the fifos this often, the tx side has no interrupt of its own.
+#define SYSCALLS_POLL_TICKS calcMtimecmpMicroseconds(BUS_FREQ_HZ, 100)
+
+// second output for stdout and stderr, see setWriteSink. volatile so the
+// accesses stay inside the interrupts off sections around them.
+static write_sink volatile g_write_sink = NULL;
+static void * volatile gp_write_sink_ctx = NULL;
+
+// wait conditions for waitClintTimer
+static int uartRxReady(void *p_ctx)
+{
+  return getUartRxFifoValid((struct s_uart *)p_ctx);
+}
+
+static int uartTxReady(void *p_ctx)
+{
+  return !getUartTxFifoFull((struct s_uart *)p_ctx);
+}
   
 int _close(int file)
 {
@@ -87,7 +111,7 @@ int _read(int file, char *ptr, int len)
   
   for(index = 0; index < len; index++)
   {
-    while(!getUartRxFifoValid(__gp_uart));
+    waitClintTimer(__gp_clint, uartRxReady, __gp_uart, CLINT_WAIT_FOREVER, SYSCALLS_POLL_TICKS);
     
     ptr[index] = getUartRxData(__gp_uart);
   }
@@ -98,15 +122,42 @@ int _read(int file, char *ptr, int len)
 int _write(int file, char *ptr, int len)
 {
   int index;
+  uint_xlen_t mstatus;
+  write_sink sink;
+  void *p_ctx;
   // we do not handle anything other than stdout or error for now
   if(file > 2 || !file) return -1;
   
   for(index = 0; index < len; index++)
   {
-    while(getUartTxFifoFull(__gp_uart));
+    if(getUartTxFifoFull(__gp_uart)) waitClintTimer(__gp_clint, uartTxReady, __gp_uart, CLINT_WAIT_FOREVER, SYSCALLS_POLL_TICKS);
     
     setUartTxData(__gp_uart, ptr[index]);
   }
   
+  // sink and context as one pair, setWriteSink may run from an irq handler.
+  mstatus = csr_read_clr_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+  
+  sink  = g_write_sink;
+  p_ctx = gp_write_sink_ctx;
+  
+  csr_set_bits_mstatus(mstatus & MSTATUS_MIE_BIT_MASK);
+  
+  if(sink) sink(ptr, len, p_ctx);
+  
   return index;
 }
+
+// set a second output for stdout and stderr
+void setWriteSink(write_sink sink, void *p_ctx)
+{
+  uint_xlen_t mstatus;
+  
+  // interrupts off, an irq handler printing in between never sees the new sink with the old context.
+  mstatus = csr_read_clr_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+  
+  gp_write_sink_ctx = p_ctx;
+  g_write_sink      = sink;
+  
+  csr_set_bits_mstatus(mstatus & MSTATUS_MIE_BIT_MASK);
+}
@@ -0,0 +1,62 @@
+/***************************************************************************//**
+  * @file     syscalls.h
+  * @brief    Hooks into the newlib syscalls.
+  * @details  Lets an app tee stdout and stderr to a second output.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __SYSCALLS_H
+#define __SYSCALLS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @typedef write_sink
+ * @brief called by _write with everything written to stdout or stderr, after
+ * it has gone out the uart. Returns the bytes it took.
+ */
+typedef int (*write_sink)(char *ptr, int len, void *p_ctx);
+
+/*********************************************//**
+  * @brief set a second output for stdout and stderr,
+  * printf, puts and beario all end up here. The uart
+  * still gets everything.
+  *
+  * @param sink function to call, NULL removes it.
+  * @param p_ctx passed to the sink on each call.
+  *************************************************/
+void setWriteSink(write_sink sink, void *p_ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
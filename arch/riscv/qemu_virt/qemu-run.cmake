@@ -0,0 +1,43 @@
+################################################################################
+### date      2026.10.19
+### author    Jay Convertino
+### brief     run apps headless under qemu-system-riscv32
+################################################################################
+
+# included by src/apps/CMakeLists.txt after the app targets exist.
+#
+# run_<app>        ... run one app, console on the terminal, no timeout.
+# qemu_regression  ... run every app in QEMU_RUN_LIST with QEMU_TIMEOUT, fail on
+#                      a non zero exit, a hang or a trap. Logs in build/qemu.
+
+find_program(QEMU_SYSTEM_RISCV32 qemu-system-riscv32)
+
+if(NOT QEMU_SYSTEM_RISCV32)
+  message(WARNING "qemu-system-riscv32 not found, no run targets.")
+  return()
+endif()
+
+set(QEMU_RUN_SCRIPT ${CMAKE_SOURCE_DIR}/arch/riscv/qemu_virt/qemu-run.sh)
+set(QEMU_LOG_DIR ${CMAKE_BINARY_DIR}/qemu)
+
+foreach(app_name IN LISTS APP_LIST)
+  add_custom_target(run_${app_name}
+    COMMAND ${QEMU_RUN_SCRIPT} -q ${QEMU_SYSTEM_RISCV32} -s ${QEMU_SMP} -t 0 -l ${QEMU_LOG_DIR} $<TARGET_FILE:${app_name}.elf>
+    DEPENDS ${app_name}.elf
+    USES_TERMINAL
+    COMMENT "Running ${app_name} under qemu")
+endforeach()
+
+set(QEMU_RUN_ELFS)
+set(QEMU_RUN_TARGETS)
+
+foreach(app_name IN LISTS QEMU_RUN_LIST)
+  list(APPEND QEMU_RUN_ELFS $<TARGET_FILE:${app_name}.elf>)
+  list(APPEND QEMU_RUN_TARGETS ${app_name}.elf)
+endforeach()
+
+add_custom_target(qemu_regression
+  COMMAND ${QEMU_RUN_SCRIPT} -q ${QEMU_SYSTEM_RISCV32} -s ${QEMU_SMP} -t ${QEMU_TIMEOUT} -l ${QEMU_LOG_DIR} ${QEMU_RUN_ELFS}
+  DEPENDS ${QEMU_RUN_TARGETS}
+  USES_TERMINAL
+  COMMENT "Running qemu regression")
@@ -0,0 +1,57 @@
+#!/bin/bash
+################################################################################
+### date      2026.10.19
+### author    Jay Convertino
+### brief     run apps headless on the qemu virt machine
+################################################################################
+#
+# usage: qemu-run.sh [-q qemu] [-s harts] [-t seconds] [-l logdir] app.elf ...
+#
+# Each app runs until it calls _Exit, which quits qemu through the sifive_test
+# device with the app return code. -t 0 is no timeout. The console goes to the
+# terminal and to logdir/app.log, ready for pcsamp.py or ftrace.py.
+# Exits non zero if any app failed, timed out or qemu could not start.
+
+QEMU=qemu-system-riscv32
+SMP=1
+TIMEOUT=0
+LOGDIR=.
+
+while getopts "q:s:t:l:" opt; do
+  case $opt in
+    q) QEMU=$OPTARG ;;
+    s) SMP=$OPTARG ;;
+    t) TIMEOUT=$OPTARG ;;
+    l) LOGDIR=$OPTARG ;;
+    *) echo "usage: $0 [-q qemu] [-s harts] [-t seconds] [-l logdir] app.elf ..."; exit 2 ;;
+  esac
+done
+
+shift $((OPTIND-1))
+
+mkdir -p "$LOGDIR"
+
+set -o pipefail
+
+failed=0
+
+for elf in "$@"; do
+  name=$(basename "$elf" .elf)
+  log="$LOGDIR/$name.log"
+
+  # icount makes mcycle count instructions, 8 ns each (shift 3), so cycle
+  # numbers repeat from run to run and match CPU_FREQ_HZ in base.h.
+  timeout --foreground "$TIMEOUT" "$QEMU" -M virt -smp "$SMP" -m 128M -bios none \
+    -icount shift=3 -display none -monitor none -serial stdio \
+    -kernel "$elf" | tee "$log"
+
+  status=$?
+
+  case $status in
+    0)   echo "QEMU PASS $name" ;;
+    124) echo "QEMU FAIL $name (timeout after ${TIMEOUT}s)"; failed=1 ;;
+    *)   echo "QEMU FAIL $name (exit $status)"; failed=1 ;;
+  esac
+done
+
+exit $failed
@@ -0,0 +1,86 @@
+/*
+   Register access functions for RISC-V system registers.
+   SPDX-License-Identifier: Unlicense
+
+   https://five-embeddev.com/
+
+*/
+
+#ifndef __RISCV_BASE_H
+#define __RISCV_BASE_H
+
+#include <stdint.h>
+        
+#define UART_ADDR     0x10000000
+#define PLIC_ADDR     0x0C000000
+#define CLINT_ADDR    0x02000000
+#define DDR_ADDR      0x80000000
+#define RAM_ADDR      0x80000000
+#define ROM_ADDR      0x80000000
+
+// sifive_test device, _Exit writes the return code here to quit qemu.
+#define SIFIVE_TEST_ADDR  0x00100000
+#define SIFIVE_TEST_PASS  0x5555
+#define SIFIVE_TEST_FAIL  0x3333
+
+//PLIC SOURCE NUMBERS
+#define UART_IRQ      10
+
+// run with -icount shift=3, one instruction every 8 ns is 125 MHz of mcycle.
+// virt mtime is fixed at 10 MHz.
+#define CPU_FREQ_HZ 125000000
+#define BUS_FREQ_HZ 10000000
+
+// compile time cycle budget for delays, replaced at startup by the calibrated value.
+#define CPU_CYCLES_PER_US (CPU_FREQ_HZ/1000000)
+
+// mcycle counts per microsecond, measured against mtime by dev_init.
+extern uint32_t __cpu_cycles_per_us;
+
+// low 32 bits of mcycle, delays compare differences so the wrap does not matter.
+static inline uint32_t __cycles(void)
+{
+  uint32_t cycles;
+
+  __asm__ volatile ("csrr %0, mcycle" : "=r"(cycles));
+
+  return cycles;
+}
+
+// busy wait for a number of cpu cycles, independent of optimization and cache state.
+static inline void __delay_cycles(uint32_t len)
+{
+  uint32_t start = __cycles();
+
+  while((uint32_t)(__cycles() - start) < len);
+}
+
+// delay for len cpu cycles
+static inline void __delay(uint32_t len)
+{
+  __delay_cycles(len);
+}
+
+// delay for len milliseconds
+static inline void __delay_ms(uint32_t len)
+{
+  while(len--)
+  {
+    __delay_cycles(__cpu_cycles_per_us * 1000);
+  }
+}
+
+// delay for len microseconds, in 1 ms chunks so the cycle count can not overflow.
+static inline void __delay_us(uint32_t len)
+{
+  while(len > 1000)
+  {
+    __delay_cycles(__cpu_cycles_per_us * 1000);
+
+    len -= 1000;
+  }
+
+  __delay_cycles(__cpu_cycles_per_us * len);
+}
+
+#endif // #define RISCV_BASE_H
@@ -13,8 +13,20 @@ set(XILINX_DRV_GPIO ON)
 set(BUILD_UTIL_FATFS ON)
 set(BUILD_UTIL_SDCARD_SPI ON)
 set(BUILD_UTIL_BMPM ON)
-
-set(DRIVER_LIST bare_metal_startup bare_metal_base irq uart_drv gpio_drv spi_drv clint_drv plic_drv axi_tft_drv sdcard_spi_util fatfs_util beario_util bmpm_util)
+set(BUILD_UTIL_SCHED ON)
+set(BUILD_UTIL_IRQLAT ON)
+set(BUILD_UTIL_DEFERRED ON)
+set(BUILD_UTIL_PROF ON)
+set(BUILD_UTIL_PCSAMP ON)
+set(BUILD_UTIL_FTRACE ON)
+set(BUILD_UTIL_FBFLIP ON)
+set(BUILD_UTIL_FBDAMAGE ON)
+set(BUILD_UTIL_FBSCROLL ON)
+set(BUILD_UTIL_FBCON ON)
+set(BUILD_UTIL_GFX2D ON)
+set(BUILD_UTIL_VIDPLAY ON)
+
+set(DRIVER_LIST bare_metal_startup bare_metal_base irq uart_drv gpio_drv spi_drv clint_drv plic_drv axi_tft_drv sdcard_spi_util fatfs_util beario_util bmpm_util sched_util irqlat_util deferred_util prof_util pcsamp_util ftrace_util fbflip_util fbdamage_util fbscroll_util fbcon_util gfx2d_util vidplay_util)
 
 # Look for GCC in path
 # https://xpack.github.io/riscv-none-embed-gcc/
@@ -26,42 +26,63 @@
 #define ROM_ADDR      0x20010000
 #define UBOOT_START  (0x00400000 + DDR_ADDR) // eventually would like to do this in BRAM using SPL (MUST BE OPENSBI START IF NOT SPL)
 
+//PLIC SOURCE NUMBERS
+#define UART_IRQ      4
+
 //BUS CLOCK FREQ, USED FOR CLINT CALC INLINE FUNCTIONS
 #define CPU_FREQ_HZ 100000000
 #define BUS_FREQ_HZ 50000000
-#define MS_DIVISOR  5000
-#define US_DIVISOR  2500000
 
-static inline void __delay(uint32_t len)
+// compile time cycle budget for delays, replaced at startup by the calibrated value.
+#define CPU_CYCLES_PER_US (CPU_FREQ_HZ/1000000)
+
+// mcycle counts per microsecond, measured against mtime by dev_init.
+extern uint32_t __cpu_cycles_per_us;
+
+// low 32 bits of mcycle, delays compare differences so the wrap does not matter.
+static inline uint32_t __cycles(void)
 {
-  volatile uint32_t index = 0;
+  uint32_t cycles;
 
-  for(index = 0; index < len; index++)
-  {
-    __asm__ volatile ("nop");
-  }
+  __asm__ volatile ("csrr %0, mcycle" : "=r"(cycles));
+
+  return cycles;
 }
 
-// rough approximations
+// busy wait for a number of cpu cycles, independent of optimization and cache state.
+static inline void __delay_cycles(uint32_t len)
+{
+  uint32_t start = __cycles();
+
+  while((uint32_t)(__cycles() - start) < len);
+}
+
+// delay for len cpu cycles
+static inline void __delay(uint32_t len)
+{
+  __delay_cycles(len);
+}
+
+// delay for len milliseconds
 static inline void __delay_ms(uint32_t len)
 {
-  volatile uint32_t index = 0;
-  
-  for(index = 0; index < len; index++)
+  while(len--)
   {
-    __delay(CPU_FREQ_HZ/MS_DIVISOR);
+    __delay_cycles(__cpu_cycles_per_us * 1000);
   }
 }
 
-// rough approximations
+// delay for len microseconds, in 1 ms chunks so the cycle count can not overflow.
 static inline void __delay_us(uint32_t len)
 {
-  volatile uint32_t index = 0;
-  
-  for(index = 0; index < len; index++)
+  while(len > 1000)
   {
-    __delay(CPU_FREQ_HZ/US_DIVISOR);
+    __delay_cycles(__cpu_cycles_per_us * 1000);
+
+    len -= 1000;
   }
+
+  __delay_cycles(__cpu_cycles_per_us * len);
 }
 
 #endif // #define RISCV_BASE_H
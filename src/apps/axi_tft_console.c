@@ -0,0 +1,66 @@
+#include <base.h>
+
+#include <axi_tft.h>
+#include <fbcon.h>
+#include <prof.h>
+#include <syscalls.h>
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define CON_LINES   200
+#define FOREGROUND  0x00C0C0C0
+#define BACKGROUND  0x00000040
+#define HIGHLIGHT   0x00FFFF00
+
+int main()
+{
+  int len = 0;
+  char line[FBCON_COLS + 1];
+
+  static struct s_fbcon con;
+
+  struct s_axi_tft *p_axi_tft = initAxiTft(TFT_ADDR);
+
+  printf("\n\rSTARTING TFT CONSOLE\n\r");
+
+  if(initFbCon(&con, FOREGROUND, BACKGROUND))
+  {
+    printf("\n\rCONSOLE ALLOCATION FAILED\n\r");
+
+    return 0;
+  }
+
+  initProf(0, 0);
+
+  setAxiTftTDEon(p_axi_tft);
+
+  // scroll a screen and a half of lines through the console, drawing after each.
+  for(uint32_t index = 0; index < CON_LINES; index++)
+  {
+    len = snprintf(line, sizeof(line), "CONSOLE LINE %lu\tTHE QUICK BROWN FOX JUMPS OVER THE LAZY DOG\n", (unsigned long)index);
+
+    if(index % 16 == 0) setFbConColor(&con, HIGHLIGHT, BACKGROUND);
+
+    PROF_START("fbcon write");
+    writeFbCon(line, len, &con);
+    PROF_STOP("fbcon write");
+
+    setFbConColor(&con, FOREGROUND, BACKGROUND);
+
+    PROF_START("fbcon draw");
+    drawFbCon(&con, getAxiTftVmemAddr(p_axi_tft), 0);
+    PROF_STOP("fbcon draw");
+  }
+
+  // from here on everything printed goes to the uart and the screen.
+  setWriteSink(writeFbCon, &con);
+
+  printProfReport();
+
+  printf("\n\rTFT CONSOLE DONE\n\r");
+
+  drawFbCon(&con, getAxiTftVmemAddr(p_axi_tft), 0);
+
+  return 0;
+}
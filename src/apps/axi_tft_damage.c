@@ -0,0 +1,90 @@
+#include <base.h>
+
+#include <axi_tft.h>
+#include <fbdamage.h>
+#include <gfx2d.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#define BOX_SIZE    64
+#define BACKGROUND  0x00202020
+#define BOX_COLOR   0x00FF8000
+
+int main()
+{
+  int32_t x = 0;
+  int32_t y = 0;
+  int32_t old_x = 0;
+  int32_t old_y = 0;
+  
+  int32_t dx = 3;
+  int32_t dy = 2;
+  
+  uint32_t frames = 0;
+  uint32_t pixels = 0;
+  
+  struct s_fbdamage damage;
+  
+  struct s_gfx2d shadow;
+  
+  struct s_axi_tft *p_axi_tft = initAxiTft(TFT_ADDR);
+  
+  // packed shadow copy of the screen, everything is drawn here first.
+  uint32_t *p_shadow = malloc(XRES*YRES*sizeof(uint32_t));
+  
+  printf("\n\rSTARTING DAMAGE TRACKED BOX\n\r");
+  
+  if(!p_shadow)
+  {
+    printf("\n\rSHADOW ALLOCATION FAILED\n\r");
+    
+    return 0;
+  }
+  
+  initFbDamage(&damage);
+  
+  initGfx2d(&shadow, (uint32_t)p_shadow, XRES, XRES, YRES);
+  
+  __delay_ms(2);
+  
+  setAxiTftTDEon(p_axi_tft);
+  
+  // first frame is the whole screen.
+  writeAxiTftVRAMconst(p_axi_tft, 0, BACKGROUND, XRES*YRES);
+  
+  fillGfx2dRect(&shadow, 0, 0, XRES, YRES, BACKGROUND);
+  
+  for(;;)
+  {
+    old_x = x;
+    old_y = y;
+    
+    if((x + dx > XRES - BOX_SIZE) || (x + dx < 0)) dx = -dx;
+    if((y + dy > YRES - BOX_SIZE) || (y + dy < 0)) dy = -dy;
+    
+    x += dx;
+    y += dy;
+    
+    // erase the old box and draw the new one in the shadow, the two overlap and merge into one copy.
+    fillGfx2dRect(&shadow, old_x, old_y, BOX_SIZE, BOX_SIZE, BACKGROUND);
+    fillGfx2dRect(&shadow, x, y, BOX_SIZE, BOX_SIZE, BOX_COLOR);
+    
+    addFbDamage(&damage, old_x, old_y, BOX_SIZE, BOX_SIZE);
+    addFbDamage(&damage, x, y, BOX_SIZE, BOX_SIZE);
+    
+    pixels += flushFbDamage(&damage, getAxiTftVmemAddr(p_axi_tft), p_shadow, XRES);
+    
+    if(++frames % 256 == 0)
+    {
+      printf("FRAMES %lu PIXELS PER FRAME %lu OF %d\n\r", frames, pixels/256, XRES*YRES);
+      
+      pixels = 0;
+    }
+    
+    __delay_ms(16);
+  }
+  
+  return 0;
+}
@@ -0,0 +1,89 @@
+#include <base.h>
+
+#include <axi_tft.h>
+#include <gfx2d.h>
+#include <prof.h>
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define BACKGROUND  0x00101030
+#define LINE_COLOR  0x0000FF80
+#define RECT_COLOR  0x00FFFFFF
+#define SHADE_COLOR 0x00000000
+#define KEY_COLOR   0x00FF00FF
+#define SPRITE_SIZE 32
+
+// a ball on a key colored square, and the same ball with an alpha edge.
+static uint32_t g_sprite_key[SPRITE_SIZE*SPRITE_SIZE];
+static uint32_t g_sprite_alpha[SPRITE_SIZE*SPRITE_SIZE];
+
+int main()
+{
+  struct s_gfx2d screen;
+  struct s_gfx2d sprite;
+
+  struct s_axi_tft *p_axi_tft = initAxiTft(TFT_ADDR);
+
+  printf("\n\rSTARTING GFX2D PRIMITIVES\n\r");
+
+  initProf(0, 0);
+
+  initGfx2d(&screen, getAxiTftVmemAddr(p_axi_tft), XRES_VIR, XRES, YRES);
+
+  initGfx2d(&sprite, (uint32_t)g_sprite_key, SPRITE_SIZE, SPRITE_SIZE, SPRITE_SIZE);
+
+  fillGfx2dRect(&sprite, 0, 0, SPRITE_SIZE, SPRITE_SIZE, KEY_COLOR);
+  fillGfx2dCircle(&sprite, SPRITE_SIZE/2, SPRITE_SIZE/2, SPRITE_SIZE/2 - 1, 0x00FF4000);
+
+  initGfx2d(&sprite, (uint32_t)g_sprite_alpha, SPRITE_SIZE, SPRITE_SIZE, SPRITE_SIZE);
+
+  fillGfx2dRect(&sprite, 0, 0, SPRITE_SIZE, SPRITE_SIZE, 0x00000000);
+  fillGfx2dCircle(&sprite, SPRITE_SIZE/2, SPRITE_SIZE/2, SPRITE_SIZE/2 - 1, 0x804080FF);
+  fillGfx2dCircle(&sprite, SPRITE_SIZE/2, SPRITE_SIZE/2, SPRITE_SIZE/2 - 5, 0xFF4080FF);
+
+  setAxiTftTDEon(p_axi_tft);
+
+  PROF_START("fill");
+  fillGfx2dRect(&screen, 0, 0, XRES, YRES, BACKGROUND);
+  PROF_STOP("fill");
+
+  // a fan of lines, some running off the screen to be clipped.
+  PROF_START("lines");
+  for(int32_t index = -XRES/2; index <= XRES + XRES/2; index += 16) drawGfx2dLine(&screen, XRES/2, YRES, index, -YRES/4, LINE_COLOR);
+  PROF_STOP("lines");
+
+  PROF_START("rects");
+  for(int32_t index = 0; index < 8; index++) drawGfx2dRect(&screen, 16 + index * 8, 16 + index * 8, XRES - 32 - index * 16, YRES - 32 - index * 16, RECT_COLOR);
+  PROF_STOP("rects");
+
+  PROF_START("circles");
+  for(int32_t index = 1; index < 16; index++) drawGfx2dCircle(&screen, XRES/2, YRES/2, index * 24, RECT_COLOR);
+  PROF_STOP("circles");
+
+  PROF_START("blend rect");
+  blendGfx2dRect(&screen, XRES/4, YRES/4, XRES/2, YRES/2, SHADE_COLOR, 160);
+  PROF_STOP("blend rect");
+
+  // clip to the shaded rect, the sprites on its edges are cut.
+  setGfx2dClip(&screen, XRES/4, YRES/4, XRES/2, YRES/2);
+
+  PROF_START("sprites");
+  for(int32_t index = 0; index < 8; index++)
+  {
+    blitGfx2dKey(&screen, XRES/4 - SPRITE_SIZE/2 + index * 48, YRES/4 - SPRITE_SIZE/2, SPRITE_SIZE, SPRITE_SIZE, g_sprite_key, SPRITE_SIZE, KEY_COLOR);
+
+    blendGfx2d(&screen, XRES/4 - SPRITE_SIZE/2 + index * 48, YRES/2, SPRITE_SIZE, SPRITE_SIZE, g_sprite_alpha, SPRITE_SIZE, GFX2D_ALPHA_PIXEL);
+
+    blendGfx2d(&screen, XRES/4 - SPRITE_SIZE/2 + index * 48, YRES/2 + SPRITE_SIZE, SPRITE_SIZE, SPRITE_SIZE, g_sprite_key, SPRITE_SIZE, index * 32);
+  }
+  PROF_STOP("sprites");
+
+  clrGfx2dClip(&screen);
+
+  printProfReport();
+
+  printf("\n\rGFX2D PRIMITIVES DONE\n\r");
+
+  return 0;
+}
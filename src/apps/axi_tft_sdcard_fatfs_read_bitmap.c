@@ -9,17 +9,17 @@
 #include <string.h>
 #include <stdio.h>
 
+// one screen row, the header chunk fits as well.
+static uint32_t g_row_buf[XRES];
+
 int main()
 {
   int error = 0;
   unsigned int len;
-  const int c_LEN = XRES*YRES*sizeof(uint32_t)+HEADER_SIZE;
-  
-  printf("\n\rSTARTING BITMAP TO RAW AXI TFT DISPLAY %d\n\r", c_LEN);
-
-  void *p_buf = malloc(c_LEN);
+  uint32_t chunk = 0;
+  uint32_t rows_left = 0;
   
-  printf("\n\rMALLOC COMPLETE\n\r");
+  printf("\n\rSTARTING BITMAP STREAM TO AXI TFT DISPLAY\n\r");
   
   FATFS file_sys;
   
@@ -50,7 +50,7 @@ int main()
 
   __delay_ms(2);
   
-  error = pf_read(p_buf, c_LEN, &len);
+  error = pf_read(g_row_buf, HEADER_SIZE, &len);
   
   if(error)
   {
@@ -58,19 +58,37 @@ int main()
     return 0;
   }
   
-  printf("CONVERT BITMAP TO RAW, %d\n\r", len);
-  
-  len = bmpmConvertToRaw(&p_buf, len);
-  
-  if(!len)
+  // rows are written straight to their flipped place in vram as they are read.
+  if(!bmpmStreamBegin(g_row_buf, len, (uint32_t *)getAxiTftVmemAddr(p_axi_tft), XRES_VIR, XRES, YRES))
   {
-    printf("FAILED TO CONVERT FILE, %d\n\r", len);
+    printf("FAILED TO PARSE BITMAP HEADER, %d\n\r", len);
     return 0;
   }
   
-  printf("WIDTH: %d HEIGHT %d WORD_LEN %d OFFSET %ld FIRST_WORD 0x%lx\n\r", bmpmGetWidth(), bmpmGetHeight(), len/sizeof(uint32_t), bmpmGetOffset(), *((uint32_t *)p_buf));
+  printf("WIDTH: %d HEIGHT %d DEPTH %d OFFSET %ld\n\r", bmpmGetWidth(), bmpmGetHeight(), bmpmGetDepth(), bmpmGetOffset());
   
-  writeAxiTftVRAMbuffer(p_axi_tft, 0, p_buf, len/sizeof(uint32_t));
+  do
+  {
+    // rest of the header and palette first, then whole rows that convert in place.
+    chunk = bmpmStreamChunkBytes();
+    
+    if(chunk > sizeof(g_row_buf)) chunk = sizeof(g_row_buf);
+    
+    error = pf_read(g_row_buf, chunk, &len);
+    
+    if(error)
+    {
+      printf("FAILED TO READ FILE, %d\n\r", error);
+      return 0;
+    }
+    
+    rows_left = bmpmStreamData(g_row_buf, len);
+  } while(rows_left && len);
+  
+  if(rows_left)
+  {
+    printf("BITMAP SHORT BY %ld ROWS\n\r", rows_left);
+  }
   
   printf("RAW IMAGE WRITTEN TO AXI TFT\n\r");
   
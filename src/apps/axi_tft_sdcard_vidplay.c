@@ -0,0 +1,151 @@
+#include <base.h>
+#include <riscv-csr.h>
+
+#include <axi_tft.h>
+#include <fbflip.h>
+#include <plic.h>
+#include <clint.h>
+#include <clint_timer.h>
+#include <irq/vector-table.h>
+#include <vidplay.h>
+
+#include <stdint.h>
+#include <stdio.h>
+
+// frames between stats reports
+#define STATS_FRAMES 64
+
+struct s_plic   *gp_plic;
+struct s_clint  *gp_clint;
+
+#ifdef TFT_IRQ
+// frame interrupt, finish the flip, called by plicDispatch for TFT_IRQ.
+static void tft_irq(uint32_t source, void *p_ctx)
+{
+  (void)source;
+  (void)p_ctx;
+
+  serviceFbFlip();
+}
+#endif
+
+int main()
+{
+  int error = 0;
+
+  uint64_t poll = 0;
+
+  FATFS file_sys;
+
+  struct s_vidplay vidplay;
+
+  struct s_axi_tft *p_axi_tft = initAxiTft(TFT_ADDR);
+
+  gp_plic  = initPlic(PLIC_ADDR);
+  gp_clint = initClint(CLINT_ADDR);
+
+  // init machine mvtec and enable machine irqs.
+  init_machine_irq();
+
+  // frame pacing and buffer waits sleep on the timer service.
+  initClintTimer(gp_clint, 10);
+
+#ifdef TFT_IRQ
+  initPlicDispatch(gp_plic);
+
+  plicRegister(TFT_IRQ, PLIC_MAX_PRIORITY, tft_irq, NULL);
+#else
+  // no frame interrupt, check the flip status every 100 us.
+  poll = BUS_FREQ_HZ/10000;
+#endif
+
+  printf("\n\rSTARTING SDCARD VIDEO PLAYBACK\n\r");
+
+  printf("\n\rMOUNT DRIVE\n\r");
+
+  error = pf_mount(&file_sys);
+
+  if(error)
+  {
+    printf("MOUNT FAILED, %d\n\r", error);
+
+    return 0;
+  }
+
+  printf("OPEN VIDEO, video.vid\n\r");
+
+  if(openVidPlay(&vidplay, &file_sys, gp_clint, "video.vid"))
+  {
+    printf("VIDEO OPEN FAILED\n\r");
+
+    return 0;
+  }
+
+  printf("WIDTH: %d HEIGHT: %d FRAMES: %ld FRAME US: %ld EXTENTS: %ld\n\r", vidplay.header.width, vidplay.header.height, vidplay.header.frames, vidplay.header.frame_us, vidplay.num_extents);
+
+  __delay_ms(2);
+
+  setAxiTftTDEon(p_axi_tft);
+
+  if(initFbFlip(p_axi_tft, 2, poll))
+  {
+    printf("\n\rFRAMEBUFFER ALLOCATION FAILED\n\r");
+
+    return 0;
+  }
+
+  // both buffers black, the video only draws its own rect.
+  for(int index = 0; index < 2; index++)
+  {
+    fillAxiTftVmemRect(getFbFlipBack(), 0, 0, XRES, YRES, 0);
+
+    submitFbFlip();
+  }
+
+  for(;;)
+  {
+    if(stepVidPlay(&vidplay))
+    {
+      printf("\n\rPLAYBACK FAILED AT FRAME %ld\n\r", vidplay.frame);
+
+      break;
+    }
+
+    if(getVidPlayStats(&vidplay)->frames >= STATS_FRAMES)
+    {
+      printVidPlayStats(&vidplay);
+
+      clrVidPlayStats(&vidplay);
+    }
+  }
+
+  closeVidPlay(&vidplay);
+
+  for(;;)
+  {
+    __delay_ms(1000);
+  }
+
+  return 0;
+}
+
+#pragma GCC push_options
+// Force the alignment for mtvec.BASE. A 'C' extension program could be aligned to to bytes.
+#pragma GCC optimize ("align-functions=4")
+
+#ifdef TFT_IRQ
+// The 'riscv_mtvec_mei' function is added to the vector table by the vector_table.c
+void riscv_mtvec_mei(void)
+{
+  plicDispatch();
+}
+#endif
+
+// The 'riscv_mtvec_mti' function is added to the vector table by the vector_table.c
+void riscv_mtvec_mti(void)
+{
+  // wakes waitClintTimer for frame pacing and buffer waits.
+  serviceClintTimer();
+}
+
+#pragma GCC pop_options
@@ -1,35 +1,85 @@
 #include <base.h>
+#include <riscv-csr.h>
 
 #include <axi_tft.h>
+#include <fbflip.h>
+#include <plic.h>
+#include <clint.h>
+#include <clint_timer.h>
+#include <irq/vector-table.h>
 
 #include <stdint.h>
 #include <stdio.h>
 
+struct s_plic   *gp_plic;
+struct s_clint  *gp_clint;
+
+#ifdef TFT_IRQ
+// frame interrupt, finish the flip, called by plicDispatch for TFT_IRQ.
+static void tft_irq(uint32_t source, void *p_ctx)
+{
+  (void)source;
+  (void)p_ctx;
+
+  serviceFbFlip();
+}
+#endif
+
 int main()
 {
   uint32_t const_data = 0;
   
+  uint32_t back = 0;
+  
+  uint64_t poll = 0;
+  
   uint8_t pixel = 0;
   
   uint8_t shift = 0;
   
   struct s_axi_tft *p_axi_tft = initAxiTft(TFT_ADDR);
+  
+  gp_plic  = initPlic(PLIC_ADDR);
+  gp_clint = initClint(CLINT_ADDR);
+  
+  // init machine mvtec and enable machine irqs.
+  init_machine_irq();
+  
+  // waits for a free buffer sleep on the timer service.
+  initClintTimer(gp_clint, 10);
+  
+#ifdef TFT_IRQ
+  initPlicDispatch(gp_plic);
+  
+  plicRegister(TFT_IRQ, PLIC_MAX_PRIORITY, tft_irq, NULL);
+#else
+  // no frame interrupt, check the flip status every 100 us.
+  poll = BUS_FREQ_HZ/10000;
+#endif
 
   __delay_ms(2);
   
   setAxiTftTDEon(p_axi_tft);
   
-  setAxiTftIntrEna(p_axi_tft);
-  
   printf("\n\rSTARTING COLOR PIXEL WRITES\n\r");
   
   printf("\n\rVIDEO ADDRESS 0x%lx\n\r", getAxiTftVmemAddr(p_axi_tft));
   
+  if(initFbFlip(p_axi_tft, 2, poll))
+  {
+    printf("\n\rFRAMEBUFFER ALLOCATION FAILED\n\r");
+    
+    return 0;
+  }
+  
   for(;;)
   {
-    while(!getAxiTftStatus(p_axi_tft));
+    // draw off screen, the flip lands at the next vsync.
+    back = getFbFlipBack();
     
-    writeAxiTftVRAMconst(p_axi_tft, 0, const_data, XRES*YRES);
+    fillAxiTftVmemRect(back, 0, 0, XRES, YRES, const_data);
+    
+    submitFbFlip();
     
     pixel++;
     
@@ -39,3 +89,24 @@ int main()
       shift = (shift+1)%3;
   }
 }
+
+#pragma GCC push_options
+// Force the alignment for mtvec.BASE. A 'C' extension program could be aligned to to bytes.
+#pragma GCC optimize ("align-functions=4")
+
+#ifdef TFT_IRQ
+// The 'riscv_mtvec_mei' function is added to the vector table by the vector_table.c
+void riscv_mtvec_mei(void)
+{
+  plicDispatch();
+}
+#endif
+
+// The 'riscv_mtvec_mti' function is added to the vector table by the vector_table.c
+void riscv_mtvec_mti(void)
+{
+  // wakes waitClintTimer for the next status poll.
+  serviceClintTimer();
+}
+
+#pragma GCC pop_options
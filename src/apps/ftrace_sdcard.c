@@ -0,0 +1,53 @@
+#include <base.h>
+
+#include <ftrace.h>
+#include <sdcard_spi/sdcard_spi.h>
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define TRACE_ENTRIES 4096
+
+int main()
+{
+  uint8_t r_buf[512];
+
+  struct s_sdcard_spi sdcard_spi;
+
+  printf("\n\rFTRACE SDCARD\n\r");
+
+  if(initFtrace(TRACE_ENTRIES))
+  {
+    printf("FTRACE INIT FAILED\n\r");
+    return 1;
+  }
+
+  startFtrace();
+
+  if(initSdcardSpi(&sdcard_spi, SPI_ADDR, 0))
+  {
+    stopFtrace();
+    printf("SDCARD INIT FAILED: %s\n\r", getSdcardSpiStateString(&sdcard_spi));
+  }
+  else
+  {
+    // keep only the read in the trace
+    stopFtrace();
+    clrFtrace();
+    startFtrace();
+
+    readSdcardSpi(&sdcard_spi, 0, r_buf, 0, sizeof(r_buf));
+
+    stopFtrace();
+  }
+
+  if(!getFtraceCount()) printf("NO RECORDS, CONFIGURE WITH -DINSTRUMENT_FUNCTIONS=ON\n\r");
+
+  printFtrace();
+
+  freeFtrace();
+
+  printf("\n\rFTRACE SDCARD DONE\n\r");
+
+  return 0;
+}
@@ -0,0 +1,149 @@
+#include <base.h>
+#include <riscv-csr.h>
+
+#include <clint.h>
+#ifdef TFT_ADDR
+#include <axi_tft.h>
+#endif
+#include <irqlat.h>
+#ifdef SPI_ADDR
+#include <sdcard_spi/sdcard_spi.h>
+#endif
+#include <irq/vector-table.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define BENCH_SAMPLES   1000
+#define BENCH_PERIOD    calcMtimecmpMicroseconds(BUS_FREQ_HZ, 500)
+
+struct s_clint *gp_clint;
+
+// run one timer phase with a workload until the buffer is full.
+static void run_phase(const char *p_name, void (*workload)(void *), void *p_ctx)
+{
+  struct s_irqlat_stats stats;
+
+  startIrqLatMti(BENCH_PERIOD);
+
+  while(!isIrqLatFull())
+  {
+    if(workload) workload(p_ctx);
+  }
+
+  stopIrqLatMti();
+
+  getIrqLatStats(&stats);
+
+  printIrqLatStats(p_name, &stats);
+}
+
+// uart workload, printf to the blocking tx fifo
+static void uart_work(void *p_ctx)
+{
+  (void)p_ctx;
+
+  printf("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG\r");
+}
+
+#ifdef SPI_ADDR
+// sdcard workload, read block 0 over and over
+static void sd_work(void *p_ctx)
+{
+  uint8_t r_buf[512];
+
+  readSdcardSpi((struct s_sdcard_spi *)p_ctx, 0, r_buf, 0, sizeof(r_buf));
+}
+
+#endif
+
+#ifdef TFT_ADDR
+// tft workload, fill the screen with a constant
+static void tft_work(void *p_ctx)
+{
+  static uint32_t color = 0;
+
+  writeAxiTftVRAMconst((struct s_axi_tft *)p_ctx, 0, color++, XRES*YRES);
+}
+#endif
+
+int main()
+{
+  struct s_irqlat_stats stats;
+#ifdef SPI_ADDR
+  struct s_sdcard_spi sdcard_spi;
+#endif
+#ifdef TFT_ADDR
+  struct s_axi_tft *p_axi_tft = NULL;
+#endif
+
+  gp_clint = initClint(CLINT_ADDR);
+
+  printf("\n\rIRQ LATENCY BENCH, %d SAMPLES PER RUN\n\r", BENCH_SAMPLES);
+
+  if(initIrqLat(gp_clint, BENCH_SAMPLES, CPU_FREQ_HZ/BUS_FREQ_HZ))
+  {
+    printf("IRQLAT INIT FAILED\n\r");
+    return 1;
+  }
+
+  // init machine mvtec and enable machine irqs.
+  init_machine_irq();
+
+  setClintMTimeCmp(gp_clint, ~(uint64_t)0);
+
+  runIrqLatMsi(BENCH_SAMPLES);
+
+  getIrqLatStats(&stats);
+
+  printIrqLatStats("msi entry", &stats);
+
+  run_phase("mti idle", NULL, NULL);
+
+  run_phase("mti uart", uart_work, NULL);
+
+#ifdef SPI_ADDR
+  if(!initSdcardSpi(&sdcard_spi, SPI_ADDR, 0))
+  {
+    run_phase("mti sdcard", sd_work, &sdcard_spi);
+  }
+  else
+  {
+    printf("\n\rSDCARD SKIPPED: %s\n\r", getSdcardSpiStateString(&sdcard_spi));
+  }
+
+#endif
+
+#ifdef TFT_ADDR
+  p_axi_tft = initAxiTft(TFT_ADDR);
+
+  setAxiTftTDEon(p_axi_tft);
+
+  run_phase("mti tft", tft_work, p_axi_tft);
+#endif
+
+  freeIrqLat();
+
+  printf("\n\rIRQ LATENCY BENCH DONE\n\r");
+
+  return 0;
+}
+
+#pragma GCC push_options
+// Force the alignment for mtvec.BASE. A 'C' extension program could be aligned to to bytes.
+#pragma GCC optimize ("align-functions=4")
+
+// The 'riscv_mtvec_msi' function is added to the vector table by the vector_table.c
+void riscv_mtvec_msi(void)
+{
+  irqLatMsiHandler();
+}
+
+// The 'riscv_mtvec_mti' function is added to the vector table by the vector_table.c
+void riscv_mtvec_mti(void)
+{
+  irqLatMtiHandler();
+}
+
+#pragma GCC pop_options
@@ -4,7 +4,9 @@
 #include <gpio.h>
 #include <plic.h>
 #include <clint.h>
+#include <clint_timer.h>
 #include <irq/vector-table.h>
+#include <irq/nested-irq.h>
 
 #include <stdio.h>
 #include <stdint.h>
@@ -23,6 +25,22 @@ static volatile uint64_t wtf_count = 0;
 
 static volatile uint64_t seconds = 0;
 
+static struct s_clint_timer led_timer;
+
+// one second tick, runs from serviceClintTimer in the timer irq.
+static void led_tick(void *p_ctx)
+{
+  struct s_gpio *p_gpio = (struct s_gpio *)p_ctx;
+
+  seconds++;
+
+  p_gpio->data1 = seconds;
+
+  timestamp = getClintMTime(gp_clint);
+
+  printf("\n\rLED EXAMPLE TIMER IRQ\n\r");
+}
+
 int main()
 {
   gp_gpio  = initGpio(GPIO_ADDR);
@@ -32,10 +50,12 @@ int main()
   // init machine mvtec and enable machine irqs.
   init_machine_irq();
 
-  // Setup timer for 1 second interval
+  // Setup timer for 1 second interval, mtime runs at the bus clock.
   timestamp = getClintMTime(gp_clint);
 
-  setClintMTimeCmpOffset(gp_clint, calcMtimecmpSeconds(BUS_FREQ_HZ, 1));
+  initClintTimer(gp_clint, 10);
+
+  setClintTimerPeriodic(&led_timer, calcMtimecmpSeconds(BUS_FREQ_HZ, 1), led_tick, gp_gpio);
 
   for(;;)
   {
@@ -53,17 +73,11 @@ int main()
 #pragma GCC optimize ("align-functions=4")
 
 // The 'riscv_mtvec_mti' function is added to the vector table by the vector_table.c
-void riscv_mtvec_mti(void)
+// The printf in led_tick is slow, let external interrupts preempt it.
+NESTED_IRQ_HANDLER(riscv_mtvec_mti, MIE_MTI_BIT_MASK)
 {
-  seconds++;
-
-  gp_gpio->data1 = seconds;
-  // Timer exception, re-program the timer for a one second tick.
-  timestamp = getClintMTime(gp_clint);
-
-  setClintMTimeCmpOffset(gp_clint, calcMtimecmpSeconds(CPU_FREQ_HZ, 1));
-
-  printf("\n\rLED EXAMPLE TIMER IRQ\n\r");
+  // Timer exception, run expired timers and re-program mtimecmp.
+  serviceClintTimer();
 }
 // The 'riscv_mtvec_exception' function is added to the vector table by the vector_table.c
 // This function looks at the cause of the exception, if it is an 'ecall' instruction then increment a global counter.
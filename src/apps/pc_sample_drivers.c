@@ -0,0 +1,97 @@
+#include <base.h>
+
+#include <clint.h>
+#ifdef TFT_ADDR
+#include <axi_tft.h>
+#endif
+#include <pcsamp.h>
+#ifdef PCSAMP_FATFS
+#include <pff3a/diskio.h>
+#endif
+#include <irq/vector-table.h>
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define SAMPLE_LOOPS    64
+#define SAMPLE_PERIOD   calcMtimecmpMicroseconds(BUS_FREQ_HZ, 100)
+#define SAMPLE_DITHER   0xFF
+#define SAMPLE_FILE     "PCSAMP.TXT"
+
+struct s_clint *gp_clint;
+
+int main()
+{
+  uint32_t index;
+#ifdef PCSAMP_FATFS
+  uint8_t r_buf[512];
+  uint8_t sd_ok = 0;
+
+  FATFS file_sys;
+  UINT bytes_read = 0;
+#endif
+#ifdef TFT_ADDR
+  struct s_axi_tft *p_axi_tft = NULL;
+#endif
+
+  gp_clint = initClint(CLINT_ADDR);
+
+  printf("\n\rPC SAMPLE DRIVERS, %d LOOPS\n\r", SAMPLE_LOOPS);
+
+  // 2 byte bins, one per compressed instruction, 256 call graph slots.
+  if(initPcSamp(gp_clint, 1, 256))
+  {
+    printf("PCSAMP INIT FAILED\n\r");
+    return 1;
+  }
+
+#ifdef PCSAMP_FATFS
+  sd_ok = (pf_mount(&file_sys) == FR_OK);
+
+  if(!sd_ok) printf("SDCARD SKIPPED\n\r");
+#endif
+
+#ifdef TFT_ADDR
+  p_axi_tft = initAxiTft(TFT_ADDR);
+
+  setAxiTftTDEon(p_axi_tft);
+#endif
+
+  // init machine mvtec and enable machine irqs.
+  init_machine_irq();
+
+  startPcSamp(SAMPLE_PERIOD, SAMPLE_DITHER);
+
+  for(index = 0; index < SAMPLE_LOOPS; index++)
+  {
+    printf("PC SAMPLE LOOP %lu\r", (unsigned long)index);
+
+#ifdef PCSAMP_FATFS
+    if(sd_ok && (pf_open(SAMPLE_FILE) == FR_OK)) pf_read(r_buf, sizeof(r_buf), &bytes_read);
+#endif
+
+#ifdef TFT_ADDR
+    writeAxiTftVRAMconst(p_axi_tft, 0, index, XRES*YRES);
+#endif
+  }
+
+  stopPcSamp();
+
+  printPcSamp();
+
+#ifdef PCSAMP_FATFS
+  if(sd_ok)
+  {
+    printf("\n\rWRITE %s %s\n\r", SAMPLE_FILE, (writePcSampFile(SAMPLE_FILE) ? "FAILED" : "DONE"));
+  }
+#endif
+
+  freePcSamp();
+
+  printf("\n\rPC SAMPLE DRIVERS DONE\n\r");
+
+  return 0;
+}
+
+// The 'riscv_mtvec_mti' function is added to the vector table by the vector_table.c
+PCSAMP_HANDLER(riscv_mtvec_mti);
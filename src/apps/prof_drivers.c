@@ -0,0 +1,86 @@
+#include <base.h>
+
+#ifdef TFT_ADDR
+#include <axi_tft.h>
+#endif
+#include <prof.h>
+#ifdef SPI_ADDR
+#include <sdcard_spi/sdcard_spi.h>
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define PROF_LOOPS  16
+
+// print one line, nested inside the uart region
+static void uart_line(uint32_t index)
+{
+  PROF_START("printf");
+
+  printf("PROF LOOP %lu\r", (unsigned long)index);
+
+  PROF_STOP("printf");
+}
+
+int main()
+{
+  uint32_t index;
+#ifdef SPI_ADDR
+  uint8_t r_buf[512];
+  uint8_t sd_ok = 0;
+
+  struct s_sdcard_spi sdcard_spi;
+#endif
+#ifdef TFT_ADDR
+  struct s_axi_tft *p_axi_tft = NULL;
+#endif
+
+  initProf(0, 0);
+
+  printf("\n\rPROFILE DRIVERS, %d LOOPS\n\r", PROF_LOOPS);
+
+#ifdef SPI_ADDR
+  sd_ok = !initSdcardSpi(&sdcard_spi, SPI_ADDR, 0);
+
+  if(!sd_ok) printf("SDCARD SKIPPED: %s\n\r", getSdcardSpiStateString(&sdcard_spi));
+#endif
+
+#ifdef TFT_ADDR
+  p_axi_tft = initAxiTft(TFT_ADDR);
+
+  setAxiTftTDEon(p_axi_tft);
+#endif
+
+  for(index = 0; index < PROF_LOOPS; index++)
+  {
+    PROF_START("loop");
+
+    PROF_START("uart");
+    uart_line(index);
+    PROF_STOP("uart");
+
+#ifdef SPI_ADDR
+    if(sd_ok)
+    {
+      PROF_START("sdcard read");
+      readSdcardSpi(&sdcard_spi, 0, r_buf, 0, sizeof(r_buf));
+      PROF_STOP("sdcard read");
+    }
+#endif
+
+#ifdef TFT_ADDR
+    PROF_START("tft fill");
+    writeAxiTftVRAMconst(p_axi_tft, 0, index, XRES*YRES);
+    PROF_STOP("tft fill");
+#endif
+
+    PROF_STOP("loop");
+  }
+
+  printProfReport();
+
+  printf("\n\rPROFILE DRIVERS DONE\n\r");
+
+  return 0;
+}
@@ -0,0 +1,87 @@
+#include <base.h>
+#include <riscv-csr.h>
+
+#include <gpio.h>
+#include <uart.h>
+#include <clint.h>
+#include <clint_timer.h>
+#include <sched.h>
+#include <irq/vector-table.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+struct s_gpio   *gp_gpio;
+struct s_uart   *gp_uart;
+struct s_clint  *gp_clint;
+
+static struct s_uart_line uart_line;
+
+// toggle the LEDs twice a second.
+static void led_task(void *p_arg)
+{
+  struct s_gpio *p_gpio = (struct s_gpio *)p_arg;
+
+  uint32_t count = 0;
+
+  for(;;)
+  {
+    p_gpio->data1 = count++;
+
+    sleepSched(calcMtimecmpMilliseconds(BUS_FREQ_HZ, 500));
+  }
+}
+
+// echo lines typed on the uart, recvUartLine yields while waiting.
+static void console_task(void *p_arg)
+{
+  struct s_uart_line *p_line = (struct s_uart_line *)p_arg;
+
+  char line[UART_LINE_MAX];
+
+  for(;;)
+  {
+    if(recvUartLine(p_line, line, sizeof(line)) > 0)
+    {
+      printf("\n\rGOT: %s\n\r", line);
+    }
+  }
+}
+
+int main()
+{
+  gp_gpio  = initGpio(GPIO_ADDR);
+  gp_uart  = initUart(UART_ADDR);
+  gp_clint = initClint(CLINT_ADDR);
+
+  // init machine mvtec and enable machine irqs.
+  init_machine_irq();
+
+  initClintTimer(gp_clint, 10);
+
+  initUartLine(&uart_line, gp_uart, gp_clint, NULL, 0);
+
+  initSched(gp_clint);
+
+  createSchedTask("led", led_task, gp_gpio, 1024);
+
+  createSchedTask("console", console_task, &uart_line, 2048);
+
+  runSched();
+
+  return 0;
+}
+
+#pragma GCC push_options
+// Force the alignment for mtvec.BASE. A 'C' extension program could be aligned to to bytes.
+#pragma GCC optimize ("align-functions=4")
+
+// The 'riscv_mtvec_mti' function is added to the vector table by the vector_table.c
+void riscv_mtvec_mti(void)
+{
+  // wakes the scheduler for task sleeps and timeouts.
+  serviceClintTimer();
+}
+
+#pragma GCC pop_options
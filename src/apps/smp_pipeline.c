@@ -0,0 +1,95 @@
+#include <base.h>
+
+#include <clint.h>
+#include <smp.h>
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define BLOCK_SIZE    256
+#define BLOCK_COUNT   64
+
+struct s_stage
+{
+  struct s_smp_lock lock;
+  volatile uint32_t full;
+  volatile uint32_t done;
+  int32_t block[BLOCK_SIZE];
+  int64_t result;
+};
+
+struct s_stage g_stage;
+
+// each hart has its own copy
+__thread uint32_t t_blocks;
+
+// second stage, runs on hart 1 and sums each block hart 0 hands over
+static void dsp_stage(void *p_arg)
+{
+  uint32_t index;
+  struct s_stage *p_stage = (struct s_stage *)p_arg;
+
+  while(!p_stage->done)
+  {
+    if(!p_stage->full) continue;
+
+    lockSmp(&p_stage->lock);
+
+    for(index = 0; index < BLOCK_SIZE; index++)
+    {
+      p_stage->result += (int64_t)p_stage->block[index] * p_stage->block[index];
+    }
+
+    p_stage->full = 0;
+
+    t_blocks++;
+
+    unlockSmp(&p_stage->lock);
+  }
+}
+
+int main()
+{
+  uint32_t index;
+  uint32_t count;
+  struct s_clint *p_clint = NULL;
+
+  p_clint = initClint(CLINT_ADDR);
+
+  printf("\n\rSMP PIPELINE ON HART %lu OF %lu\n\r", (unsigned long)getSmpHartId(), (unsigned long)getSmpNumHarts());
+
+  if(startSmpHart(p_clint, 1, dsp_stage, &g_stage))
+  {
+    printf("NO SECOND HART, LINK WITH -Xlinker --defsym=__num_harts=2\n\r");
+    return 1;
+  }
+
+  // first stage, produce blocks for hart 1
+  for(count = 0; count < BLOCK_COUNT; count++)
+  {
+    while(g_stage.full);
+
+    lockSmp(&g_stage.lock);
+
+    for(index = 0; index < BLOCK_SIZE; index++)
+    {
+      g_stage.block[index] = (int32_t)(index + count);
+    }
+
+    g_stage.full = 1;
+
+    t_blocks++;
+
+    unlockSmp(&g_stage.lock);
+  }
+
+  while(g_stage.full);
+
+  g_stage.done = 1;
+
+  waitSmpHart(1);
+
+  printf("HART 0 MADE %lu BLOCKS, SUM OF SQUARES %lld\n\r", (unsigned long)t_blocks, (long long)g_stage.result);
+
+  return 0;
+}
@@ -23,7 +23,7 @@ int main()
   {
     __delay_ms(2);
 
-    if(p_uart->status.bits.rx_fifo_valid)
+    if(getUartRxFifoValid(p_uart) > 0)
     {
       uint8_t temp;
 
@@ -4,7 +4,9 @@
 #include <uart.h>
 #include <plic.h>
 #include <clint.h>
+#include <deferred.h>
 #include <irq/vector-table.h>
+#include <irq/nested-irq.h>
 
 #include <stdint.h>
 #include <stdlib.h>
@@ -20,6 +22,60 @@ static volatile uint64_t timestamp = 0;
 
 static volatile uint64_t wtf_count = 0;
 
+#define RX_RING_SIZE 256
+
+// filled by the hard handler, emptied by the deferred echo.
+static volatile uint8_t  rx_ring[RX_RING_SIZE];
+static volatile uint16_t rx_head = 0;
+static volatile uint16_t rx_tail = 0;
+static volatile uint8_t  echo_queued = 0;
+
+// deferred work, echo everything the hard handler saved.
+static void echo_work(void *p_ctx)
+{
+  struct s_uart *p_uart = (struct s_uart *)p_ctx;
+
+  echo_queued = 0;
+
+  while(rx_tail != rx_head)
+  {
+    while(getUartTxFifoFull(p_uart));
+
+    setUartTxData(p_uart, rx_ring[rx_tail]);
+
+    rx_tail = (rx_tail + 1) % RX_RING_SIZE;
+  }
+}
+
+// empty the rx fifo and defer the echo, called by plicDispatch for UART_IRQ.
+static void uart_irq(uint32_t source, void *p_ctx)
+{
+  struct s_uart *p_uart = (struct s_uart *)p_ctx;
+
+  (void)source;
+
+  while(getUartRxFifoValid(p_uart) > 0)
+  {
+    uint16_t next = (rx_head + 1) % RX_RING_SIZE;
+
+    uint8_t data = getUartRxData(p_uart);
+
+    // full, drop it.
+    if(next == rx_tail) continue;
+
+    rx_ring[rx_head] = data;
+
+    rx_head = next;
+  }
+
+  if(!echo_queued)
+  {
+    echo_queued = 1;
+
+    postDeferred(echo_work, p_uart);
+  }
+}
+
 int main()
 {
   gp_plic  = initPlic(PLIC_ADDR);
@@ -29,15 +85,16 @@ int main()
   // init machine mvtec and enable machine irqs.
   init_machine_irq();
 
-  // setup plic to enable interrupt 4, uart.
-  gp_plic->priority4 = 7;
+  // echo runs from the software interrupt, after the hard handler.
+  initDeferred(gp_clint);
 
-  gp_plic->threshold = 0;
+  // setup plic dispatch and hook the uart to it.
+  initPlicDispatch(gp_plic);
 
-  gp_plic->enable1.bits.i4 = 1;
+  plicRegister(UART_IRQ, PLIC_MAX_PRIORITY, uart_irq, gp_uart);
 
   // setup uart to enable interrupts
-  gp_uart->control.bits.ena_intr = 1;
+  setUartIntrEna(gp_uart);
 
   // Setup timer for 1 second interval
   timestamp = getClintMTime(gp_clint);
@@ -61,20 +118,14 @@ int main()
 // The 'riscv_mtvec_mei' function is added to the vector table by the vector_table.c
 void riscv_mtvec_mei(void)
 {
-  uint32_t claim_num = 0;
-
-  claim_num = gp_plic->claim;
-
-  if(gp_uart->status.bits.rx_fifo_valid && gp_uart->status.bits.intr_ena)
-  {
-    uint8_t temp;
-
-    temp = getUartRxData(gp_uart);
-
-    setUartTxData(gp_uart, temp);
-  }
+  plicDispatch();
+}
 
-  gp_plic->claim = claim_num;
+// The 'riscv_mtvec_msi' function is added to the vector table by the vector_table.c
+// Deferred work runs with interrupts back on, the uart can refill the ring meanwhile.
+NESTED_IRQ_HANDLER(riscv_mtvec_msi, MIE_MSI_BIT_MASK)
+{
+  runDeferred();
 }
 
 // The 'riscv_mtvec_mti' function is added to the vector table by the vector_table.c
@@ -160,6 +160,61 @@ void writeAxiTftVRAMbuffer(struct s_axi_tft *p_axi_tft, uint32_t start, void *p_
   *************************************************/
 void writeAxiTftVRAMconst(struct s_axi_tft *p_axi_tft, uint32_t start, uint32_t const_data, uint32_t len);
 
+/*********************************************//**
+  * @brief Copy a rectangle of pixels to vram, clipped to
+  * XRES by YRES. Rows are copied a word at a time, 8 per loop.
+  * 
+  * @param p_axi_tft pre initialized struct from initAxiTft
+  * @param x left column of the rectangle.
+  * @param y top row of the rectangle.
+  * @param w width in pixels.
+  * @param h height in pixels.
+  * @param p_src 32bit a8r8g8b8 source, top left pixel first.
+  * @param src_stride pixels from one source row to the next.
+  *************************************************/
+void blitAxiTftRect(struct s_axi_tft *p_axi_tft, uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint32_t *p_src, uint32_t src_stride);
+
+/*********************************************//**
+  * @brief Fill a rectangle of vram with one color, clipped
+  * to XRES by YRES.
+  * 
+  * @param p_axi_tft pre initialized struct from initAxiTft
+  * @param x left column of the rectangle.
+  * @param y top row of the rectangle.
+  * @param w width in pixels.
+  * @param h height in pixels.
+  * @param color 32bit unsigned data that is a8r8g8b8
+  *************************************************/
+void fillAxiTftRect(struct s_axi_tft *p_axi_tft, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint32_t color);
+
+/*********************************************//**
+  * @brief blitAxiTftRect into any framebuffer laid out
+  * like vram (XRES_VIR stride), such as a back buffer
+  * that is not being scanned out.
+  * 
+  * @param vmem_addr framebuffer base address.
+  * @param x left column of the rectangle.
+  * @param y top row of the rectangle.
+  * @param w width in pixels.
+  * @param h height in pixels.
+  * @param p_src 32bit a8r8g8b8 source, top left pixel first.
+  * @param src_stride pixels from one source row to the next.
+  *************************************************/
+void blitAxiTftVmemRect(uint32_t vmem_addr, uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint32_t *p_src, uint32_t src_stride);
+
+/*********************************************//**
+  * @brief fillAxiTftRect into any framebuffer laid out
+  * like vram (XRES_VIR stride).
+  * 
+  * @param vmem_addr framebuffer base address.
+  * @param x left column of the rectangle.
+  * @param y top row of the rectangle.
+  * @param w width in pixels.
+  * @param h height in pixels.
+  * @param color 32bit unsigned data that is a8r8g8b8
+  *************************************************/
+void fillAxiTftVmemRect(uint32_t vmem_addr, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint32_t color);
+
 #ifdef __cplusplus
 }
 #endif
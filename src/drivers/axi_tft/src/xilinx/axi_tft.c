@@ -37,6 +37,47 @@
 // Write data to vram space
 void writeAxiTftVRAM(struct s_axi_tft *p_axi_tft, uint32_t start, void *p_buffer, uint32_t len, uint32_t const_data);
 
+// copy one row of pixels, 8 words per loop. Pixels are words so source and vram are always aligned.
+static inline void copyRow(uint32_t *p_dst, const uint32_t *p_src, uint32_t count)
+{
+  for(; count >= 8; count -= 8)
+  {
+    p_dst[0] = p_src[0];
+    p_dst[1] = p_src[1];
+    p_dst[2] = p_src[2];
+    p_dst[3] = p_src[3];
+    p_dst[4] = p_src[4];
+    p_dst[5] = p_src[5];
+    p_dst[6] = p_src[6];
+    p_dst[7] = p_src[7];
+    
+    p_dst += 8;
+    p_src += 8;
+  }
+  
+  for(; count; count--) *p_dst++ = *p_src++;
+}
+
+// fill one row of pixels with a constant, 8 words per loop.
+static inline void fillRow(uint32_t *p_dst, uint32_t data, uint32_t count)
+{
+  for(; count >= 8; count -= 8)
+  {
+    p_dst[0] = data;
+    p_dst[1] = data;
+    p_dst[2] = data;
+    p_dst[3] = data;
+    p_dst[4] = data;
+    p_dst[5] = data;
+    p_dst[6] = data;
+    p_dst[7] = data;
+    
+    p_dst += 8;
+  }
+  
+  for(; count; count--) *p_dst++ = data;
+}
+
 // Initializes axi tft structure and device
 struct s_axi_tft *initAxiTft(uint32_t memory_address)
 {
@@ -151,11 +192,13 @@ void writeAxiTftVRAMconst(struct s_axi_tft *p_axi_tft, uint32_t start, uint32_t
 void writeAxiTftVRAM(struct s_axi_tft *p_axi_tft, uint32_t start, void *p_buffer, uint32_t len, uint32_t const_data)
 {
   // X should be between 0 to 640
-  uint16_t x_cor = start % XRES;
+  uint32_t x_cor = start % XRES;
   // Y needs to be a line number up to 480 from 640 X pixels drawn
-  uint16_t y_cor = start / XRES;
+  uint32_t y_cor = start / XRES;
+  
+  uint32_t count = 0;
   
-  uint32_t offset = 0;
+  const uint32_t *p_temp = (const uint32_t *)p_buffer;
   
   if(!p_axi_tft) return;
   
@@ -168,29 +211,97 @@ void writeAxiTftVRAM(struct s_axi_tft *p_axi_tft, uint32_t start, void *p_buffer
   //Buffer too short
   if(len <= 0) return;
   
-  //Get start address
-  uint32_t *p_vram = (uint32_t *)p_axi_tft->addr;
-  uint32_t *p_temp = (uint32_t *)p_buffer;
+  //Get start address, offset by the virtual res.
+  uint32_t *p_vram = (uint32_t *)p_axi_tft->addr + XRES_VIR*y_cor + x_cor;
   
-  //offset if we are starting on a line greater than 0 by the virtual res.
-  p_vram += XRES_VIR*y_cor;
-  
-  //Create up to 480 pixels high in Y.
-  for(y_cor; y_cor < YRES; y_cor++)
+  // a row (or what is left of it) at a time, the first may start mid row.
+  for(; len; y_cor++)
   {
-    //Create up to 640 pixels long in X
-    for(x_cor; x_cor < XRES; x_cor++)
+    count = XRES - x_cor;
+    
+    if(count > len) count = len;
+    
+    if(p_temp)
     {
-      //increment buffer with current x
-      *(p_vram+x_cor) = (p_temp ? *(p_temp+offset) : const_data);
+      copyRow(p_vram, p_temp, count);
       
-      if(++offset >= len) return;
+      p_temp += count;
+    }
+    else
+    {
+      fillRow(p_vram, const_data, count);
     }
     
-    //update pointer to new x plus offset unused virtual pixes.
-    p_vram = p_vram+(XRES_VIR-XRES)+x_cor;
-  
-    // reset x here since x_cor is set to start
+    len -= count;
+    
+    //update pointer to the start of the next line
+    p_vram += XRES_VIR - x_cor;
+    
     x_cor = 0;
   }
 }
+
+// Copy a rectangle of pixels to vram
+void blitAxiTftRect(struct s_axi_tft *p_axi_tft, uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint32_t *p_src, uint32_t src_stride)
+{
+  if(!p_axi_tft) return;
+  
+  blitAxiTftVmemRect(p_axi_tft->addr, x, y, w, h, p_src, src_stride);
+}
+
+// Fill a rectangle of vram with one color
+void fillAxiTftRect(struct s_axi_tft *p_axi_tft, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint32_t color)
+{
+  if(!p_axi_tft) return;
+  
+  fillAxiTftVmemRect(p_axi_tft->addr, x, y, w, h, color);
+}
+
+// Copy a rectangle of pixels to a framebuffer
+void blitAxiTftVmemRect(uint32_t vmem_addr, uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint32_t *p_src, uint32_t src_stride)
+{
+  uint32_t *p_vram = NULL;
+  
+  if(!vmem_addr) return;
+  
+  if(!p_src) return;
+  
+  if((x >= XRES) || (y >= YRES)) return;
+  
+  if(w > XRES - x) w = XRES - x;
+  
+  if(h > YRES - y) h = YRES - y;
+  
+  p_vram = (uint32_t *)vmem_addr + XRES_VIR*y + x;
+  
+  for(; h; h--)
+  {
+    copyRow(p_vram, p_src, w);
+    
+    p_vram += XRES_VIR;
+    p_src  += src_stride;
+  }
+}
+
+// Fill a rectangle of a framebuffer with one color
+void fillAxiTftVmemRect(uint32_t vmem_addr, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint32_t color)
+{
+  uint32_t *p_vram = NULL;
+  
+  if(!vmem_addr) return;
+  
+  if((x >= XRES) || (y >= YRES)) return;
+  
+  if(w > XRES - x) w = XRES - x;
+  
+  if(h > YRES - y) h = YRES - y;
+  
+  p_vram = (uint32_t *)vmem_addr + XRES_VIR*y + x;
+  
+  for(; h; h--)
+  {
+    fillRow(p_vram, color, w);
+    
+    p_vram += XRES_VIR;
+  }
+}
@@ -75,3 +75,27 @@ uint64_t getClintMTime(struct s_clint *p_clint)
 
   return (uint64_t) ((((uint64_t)mtimeh_val)<<32) | mtimel_val);
 }
+
+// raise the machine software interrupt
+void setClintMsip(struct s_clint *p_clint)
+{
+  p_clint->msip[0] = 1;
+}
+
+// clear the machine software interrupt
+void clrClintMsip(struct s_clint *p_clint)
+{
+  p_clint->msip[0] = 0;
+}
+
+// raise the machine software interrupt for a hart
+void setClintMsipHart(struct s_clint *p_clint, uint32_t hart)
+{
+  p_clint->msip[hart] = 1;
+}
+
+// clear the machine software interrupt for a hart
+void clrClintMsipHart(struct s_clint *p_clint, uint32_t hart)
+{
+  p_clint->msip[hart] = 0;
+}
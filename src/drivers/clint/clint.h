@@ -47,14 +47,14 @@ struct s_clint
 {
   /**
   * @var s_clint::msip
-  * MSIP for hart 0
+  * MSIP for each hart
   */
-  volatile uint32_t msip;
+  volatile uint32_t msip[4095];
   /**
   * @var s_clint::reserved1
   * unused regs
   */
-  volatile uint32_t reserved1[4095];
+  volatile uint32_t reserved1;
   /**
   * @var s_clint::mtimecmplw
   * timer lsw
@@ -121,6 +121,36 @@ void setClintMTimeCmpOffset(struct s_clint *p_clint, uint64_t clock_offset);
   *************************************************/
 uint64_t getClintMTime(struct s_clint *p_clint);
 
+/*********************************************//**
+  * @brief raise the machine software interrupt for hart 0
+  *
+  * @param p_clint is a struct pointing to the clint memory space
+  *************************************************/
+void setClintMsip(struct s_clint *p_clint);
+
+/*********************************************//**
+  * @brief clear the machine software interrupt for hart 0
+  *
+  * @param p_clint is a struct pointing to the clint memory space
+  *************************************************/
+void clrClintMsip(struct s_clint *p_clint);
+
+/*********************************************//**
+  * @brief raise the machine software interrupt for a hart
+  *
+  * @param p_clint is a struct pointing to the clint memory space
+  * @param hart mhartid of the hart to interrupt
+  *************************************************/
+void setClintMsipHart(struct s_clint *p_clint, uint32_t hart);
+
+/*********************************************//**
+  * @brief clear the machine software interrupt for a hart
+  *
+  * @param p_clint is a struct pointing to the clint memory space
+  * @param hart mhartid of the hart
+  *************************************************/
+void clrClintMsipHart(struct s_clint *p_clint, uint32_t hart);
+
 /*********************************************//**
   * @brief calculate number of seconds to for mtimercmp
   *
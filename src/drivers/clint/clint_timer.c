@@ -0,0 +1,443 @@
+/***************************************************************************//**
+  * @file     clint_timer.c
+  * @brief    RISCV CLINT software timers
+  * @details  Hierarchical timer wheel of one shot and periodic timers sharing the CLINT mtimecmp.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <riscv-csr.h>
+
+#include "clint_timer.h"
+
+// mask for a slot index
+#define CLINT_TIMER_SLOT_MASK (CLINT_TIMER_SLOTS - 1)
+
+// wheel tick shift for a level
+#define CLINT_TIMER_SHIFT(level) ((level) * CLINT_TIMER_SLOT_BITS)
+
+// mtimecmp value that never fires
+#define CLINT_TIMER_NEVER   (~(uint64_t)0)
+
+// Level L slot S holds timers whose expire >> (5*L) is S past base >> (5*L),
+// a bit map per level finds the next used slot without walking the lists.
+static struct
+{
+  struct s_clint *p_clint;
+  uint8_t  gran_shift;
+  uint64_t base;
+  uint64_t next;
+  uint32_t used[CLINT_TIMER_LEVELS];
+  struct s_clint_timer_node slots[CLINT_TIMER_LEVELS][CLINT_TIMER_SLOTS];
+} g_clint_timer;
+
+// scheduler hook for waitClintTimer, kept out of g_clint_timer so initClintTimer does not clear it.
+static clint_wait_yield g_clint_yield = NULL;
+
+// current wheel tick
+static uint64_t getTick(void)
+{
+  return getClintMTime(g_clint_timer.p_clint) >> g_clint_timer.gran_shift;
+}
+
+// put a timer in the slot for its expire
+static void addTimer(struct s_clint_timer *p_timer)
+{
+  int level;
+  uint64_t index  = 0;
+  uint64_t expire = p_timer->expire;
+
+  struct s_clint_timer_node *p_head = NULL;
+
+  // late timers go in the current slot and run on the next service.
+  if(expire < g_clint_timer.base) expire = g_clint_timer.base;
+
+  for(level = 0; level < CLINT_TIMER_LEVELS; level++)
+  {
+    index = expire >> CLINT_TIMER_SHIFT(level);
+
+    if((index - (g_clint_timer.base >> CLINT_TIMER_SHIFT(level))) < CLINT_TIMER_SLOTS) break;
+  }
+
+  // past the end of the wheel, park in the last slot and cascade back down later.
+  if(level == CLINT_TIMER_LEVELS)
+  {
+    level--;
+
+    index = (g_clint_timer.base >> CLINT_TIMER_SHIFT(level)) + CLINT_TIMER_SLOTS - 1;
+  }
+
+  p_timer->level = level;
+  p_timer->slot  = index & CLINT_TIMER_SLOT_MASK;
+
+  p_head = &g_clint_timer.slots[level][p_timer->slot];
+
+  p_timer->node.p_next = p_head;
+  p_timer->node.p_prev = p_head->p_prev;
+
+  p_head->p_prev->p_next = &p_timer->node;
+  p_head->p_prev = &p_timer->node;
+
+  g_clint_timer.used[level] |= (1UL << p_timer->slot);
+
+  p_timer->pending = 1;
+}
+
+// take a timer out of its slot
+static void delTimer(struct s_clint_timer *p_timer)
+{
+  struct s_clint_timer_node *p_head = &g_clint_timer.slots[p_timer->level][p_timer->slot];
+
+  p_timer->node.p_prev->p_next = p_timer->node.p_next;
+  p_timer->node.p_next->p_prev = p_timer->node.p_prev;
+
+  p_timer->node.p_next = NULL;
+  p_timer->node.p_prev = NULL;
+
+  if(p_head->p_next == p_head) g_clint_timer.used[p_timer->level] &= ~(1UL << p_timer->slot);
+
+  p_timer->pending = 0;
+}
+
+// wheel tick of the earliest used slot over all levels
+static uint64_t nextTick(void)
+{
+  int level;
+  uint64_t next = CLINT_TIMER_NEVER;
+
+  for(level = 0; level < CLINT_TIMER_LEVELS; level++)
+  {
+    uint32_t used = g_clint_timer.used[level];
+    uint32_t curr = (g_clint_timer.base >> CLINT_TIMER_SHIFT(level)) & CLINT_TIMER_SLOT_MASK;
+    uint64_t tick;
+
+    if(!used) continue;
+
+    // rotate so bit 0 is the current slot, then the lowest set bit is the next.
+    used = (used >> curr) | (curr ? (used << (CLINT_TIMER_SLOTS - curr)) : 0);
+
+    tick = ((g_clint_timer.base >> CLINT_TIMER_SHIFT(level)) + __builtin_ctz(used)) << CLINT_TIMER_SHIFT(level);
+
+    if(tick < next) next = tick;
+  }
+
+  return next;
+}
+
+// program mtimecmp for a wheel tick
+static void armTimer(uint64_t next)
+{
+  g_clint_timer.next = next;
+
+  if(next == CLINT_TIMER_NEVER)
+  {
+    setClintMTimeCmp(g_clint_timer.p_clint, CLINT_TIMER_NEVER);
+    return;
+  }
+
+  setClintMTimeCmp(g_clint_timer.p_clint, next << g_clint_timer.gran_shift);
+}
+
+// move base up to now, nothing is in the wheel before the next used slot.
+static void syncBase(void)
+{
+  uint64_t now  = getTick();
+  uint64_t next = nextTick();
+
+  if(now <= g_clint_timer.base) return;
+
+  g_clint_timer.base = (now < next ? now : next);
+}
+
+// add a timer and move mtimecmp if it is now the earliest
+static void startTimer(struct s_clint_timer *p_timer, uint64_t delay, uint64_t period, clint_timer_callback callback, void *p_ctx)
+{
+  uint_xlen_t mstatus;
+  uint64_t round;
+  uint64_t next;
+
+  if(!p_timer) return;
+
+  if(!callback) return;
+
+  if(!g_clint_timer.p_clint) return;
+
+  round = (1ULL << g_clint_timer.gran_shift) - 1;
+
+  mstatus = csr_read_clr_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+
+  if(p_timer->pending) delTimer(p_timer);
+
+  syncBase();
+
+  // round up, a timer never fires early.
+  p_timer->expire   = (getClintMTime(g_clint_timer.p_clint) + delay + round) >> g_clint_timer.gran_shift;
+  p_timer->period   = period;
+  p_timer->callback = callback;
+  p_timer->p_ctx    = p_ctx;
+
+  addTimer(p_timer);
+
+  next = nextTick();
+
+  if(next != g_clint_timer.next) armTimer(next);
+
+  csr_set_bits_mstatus(mstatus & MSTATUS_MIE_BIT_MASK);
+}
+
+// Initializes the timer service
+void initClintTimer(struct s_clint *p_clint, uint8_t gran_shift)
+{
+  int level;
+  int slot;
+
+  if(!p_clint) return;
+
+  memset(&g_clint_timer, 0, sizeof(g_clint_timer));
+
+  for(level = 0; level < CLINT_TIMER_LEVELS; level++)
+  {
+    for(slot = 0; slot < CLINT_TIMER_SLOTS; slot++)
+    {
+      g_clint_timer.slots[level][slot].p_next = &g_clint_timer.slots[level][slot];
+      g_clint_timer.slots[level][slot].p_prev = &g_clint_timer.slots[level][slot];
+    }
+  }
+
+  g_clint_timer.p_clint    = p_clint;
+  g_clint_timer.gran_shift = (gran_shift > 32 ? 32 : gran_shift);
+  g_clint_timer.base       = getTick();
+
+  armTimer(CLINT_TIMER_NEVER);
+}
+
+// start a one shot timer
+void setClintTimerOneshot(struct s_clint_timer *p_timer, uint64_t delay, clint_timer_callback callback, void *p_ctx)
+{
+  startTimer(p_timer, delay, 0, callback, p_ctx);
+}
+
+// start a periodic timer
+void setClintTimerPeriodic(struct s_clint_timer *p_timer, uint64_t period, clint_timer_callback callback, void *p_ctx)
+{
+  uint64_t ticks = (period + (1ULL << g_clint_timer.gran_shift) - 1) >> g_clint_timer.gran_shift;
+
+  startTimer(p_timer, period, (ticks ? ticks : 1), callback, p_ctx);
+}
+
+// cancel a timer
+void clrClintTimer(struct s_clint_timer *p_timer)
+{
+  uint_xlen_t mstatus;
+  uint64_t next;
+
+  if(!p_timer) return;
+
+  mstatus = csr_read_clr_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+
+  if(p_timer->pending)
+  {
+    delTimer(p_timer);
+
+    // push mtimecmp out so a cancelled timer does not cost an interrupt.
+    next = nextTick();
+
+    if(next != g_clint_timer.next) armTimer(next);
+  }
+
+  csr_set_bits_mstatus(mstatus & MSTATUS_MIE_BIT_MASK);
+}
+
+// check if a timer is pending
+int isClintTimerPending(struct s_clint_timer *p_timer)
+{
+  if(!p_timer) return 0;
+
+  return p_timer->pending;
+}
+
+// Run expired timers and program mtimecmp with the next deadline
+uint32_t serviceClintTimer(void)
+{
+  int level;
+  uint32_t count = 0;
+  uint64_t now;
+  uint64_t next;
+
+  struct s_clint_timer_node *p_head = NULL;
+  struct s_clint_timer *p_timer = NULL;
+
+  if(!g_clint_timer.p_clint) return 0;
+
+  now = getTick();
+
+  // jump slot to slot, empty ticks in between cost nothing.
+  while((next = nextTick()) <= now)
+  {
+    g_clint_timer.base = next;
+
+    // top down so a timer can drop more than one level in a pass.
+    for(level = CLINT_TIMER_LEVELS - 1; level > 0; level--)
+    {
+      if(next & ((1ULL << CLINT_TIMER_SHIFT(level)) - 1)) continue;
+
+      p_head = &g_clint_timer.slots[level][(next >> CLINT_TIMER_SHIFT(level)) & CLINT_TIMER_SLOT_MASK];
+
+      while(p_head->p_next != p_head)
+      {
+        p_timer = (struct s_clint_timer *)p_head->p_next;
+
+        delTimer(p_timer);
+
+        addTimer(p_timer);
+      }
+    }
+
+    p_head = &g_clint_timer.slots[0][next & CLINT_TIMER_SLOT_MASK];
+
+    while(p_head->p_next != p_head)
+    {
+      p_timer = (struct s_clint_timer *)p_head->p_next;
+
+      delTimer(p_timer);
+
+      // requeue before the callback so it can cancel or restart itself.
+      if(p_timer->period)
+      {
+        p_timer->expire += p_timer->period;
+
+        if(p_timer->expire <= g_clint_timer.base) p_timer->expire = g_clint_timer.base + p_timer->period;
+
+        addTimer(p_timer);
+      }
+
+      p_timer->callback(p_timer->p_ctx);
+
+      count++;
+    }
+  }
+
+  armTimer(next);
+
+  return count;
+}
+
+// wake up timer for waitClintTimer, the interrupt is all that is needed.
+static void wakeTimer(void *p_ctx)
+{
+  (void)p_ctx;
+}
+
+// wait for a condition or a timeout
+int waitClintTimer(struct s_clint *p_clint, clint_wait_cond cond, void *p_ctx, uint64_t timeout, uint64_t poll)
+{
+  int result = 1;
+  uint_xlen_t mstatus;
+  uint64_t now;
+  uint64_t wake;
+  uint64_t deadline = CLINT_WAIT_FOREVER;
+
+  struct s_clint_timer wait_timer;
+
+  if(!p_clint) p_clint = g_clint_timer.p_clint;
+
+  if(!p_clint) timeout = CLINT_WAIT_FOREVER;
+
+  if(timeout != CLINT_WAIT_FOREVER) deadline = getClintMTime(p_clint) + timeout;
+
+  // let a scheduler run something else, interrupts off means a handler, the hook refuses nested handlers itself.
+  if(g_clint_yield && (csr_read_mstatus() & MSTATUS_MIE_BIT_MASK))
+  {
+    result = g_clint_yield(cond, p_ctx, deadline);
+
+    if(result >= 0) return result;
+
+    result = 1;
+  }
+
+  // without the service or with interrupts off (called from a handler) nothing can wake a wfi.
+  if(!g_clint_timer.p_clint || !(csr_read_mstatus() & MSTATUS_MIE_BIT_MASK) || !(csr_read_mie() & MIE_MTI_BIT_MASK))
+  {
+    for(;;)
+    {
+      if(cond && cond(p_ctx)) return 0;
+
+      if((deadline != CLINT_WAIT_FOREVER) && (getClintMTime(p_clint) >= deadline)) return 1;
+    }
+  }
+
+  memset(&wait_timer, 0, sizeof(wait_timer));
+
+  for(;;)
+  {
+    // check and sleep with interrupts off, a wake up between them still ends the wfi.
+    mstatus = csr_read_clr_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+
+    if(cond && cond(p_ctx))
+    {
+      result = 0;
+      break;
+    }
+
+    now = getClintMTime(p_clint);
+
+    if(now >= deadline) break;
+
+    wake = deadline;
+
+    if(poll && ((deadline - now) > poll)) wake = now + poll;
+
+    if(wake != CLINT_WAIT_FOREVER) setClintTimerOneshot(&wait_timer, wake - now, wakeTimer, NULL);
+
+    __asm__ volatile ("wfi");
+
+    // let the pending interrupt run its handler.
+    csr_set_bits_mstatus(mstatus & MSTATUS_MIE_BIT_MASK);
+  }
+
+  clrClintTimer(&wait_timer);
+
+  csr_set_bits_mstatus(mstatus & MSTATUS_MIE_BIT_MASK);
+
+  return result;
+}
+
+// set a hook that waitClintTimer tries before sleeping
+void setClintTimerYield(clint_wait_yield yield)
+{
+  g_clint_yield = yield;
+}
+
+// sleep for a number of mtime ticks
+void sleepClintTimer(struct s_clint *p_clint, uint64_t delay)
+{
+  waitClintTimer(p_clint, NULL, NULL, delay, 0);
+}
@@ -0,0 +1,259 @@
+/***************************************************************************//**
+  * @file     clint_timer.h
+  * @brief    RISCV CLINT software timers
+  * @details  Hierarchical timer wheel of one shot and periodic timers sharing the CLINT mtimecmp.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __CLINT_TIMER_H
+#define __CLINT_TIMER_H
+
+#include <stdint.h>
+
+#include "clint.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def CLINT_TIMER_LEVELS
+ * number of wheel levels
+ */
+#define CLINT_TIMER_LEVELS  4
+
+/**
+ * @def CLINT_TIMER_SLOT_BITS
+ * log2 of the slots per level
+ */
+#define CLINT_TIMER_SLOT_BITS 5
+
+/**
+ * @def CLINT_TIMER_SLOTS
+ * slots per level, one bit each in a 32 bit map.
+ */
+#define CLINT_TIMER_SLOTS   (1 << CLINT_TIMER_SLOT_BITS)
+
+/**
+ * @def CLINT_WAIT_FOREVER
+ * timeout for waitClintTimer that never expires
+ */
+#define CLINT_WAIT_FOREVER  (~(uint64_t)0)
+
+/**
+ * @typedef clint_timer_callback
+ * @brief called from serviceClintTimer when a timer expires (interrupt context).
+ */
+typedef void (*clint_timer_callback)(void *p_ctx);
+
+/**
+ * @typedef clint_wait_cond
+ * @brief condition for waitClintTimer, return non zero when done waiting.
+ */
+typedef int (*clint_wait_cond)(void *p_ctx);
+
+/**
+ * @typedef clint_wait_yield
+ * @brief hook for waitClintTimer to hand the wait to a scheduler.
+ *
+ * Return -1 if the caller can not yield (not in a task, or in a
+ * nested interrupt handler), otherwise
+ * block the calling task until cond or the mtime deadline and
+ * return 0 for the condition or 1 for the deadline.
+ */
+typedef int (*clint_wait_yield)(clint_wait_cond cond, void *p_ctx, uint64_t deadline);
+
+/**
+ * @struct s_clint_timer_node
+ * @brief wheel list links
+ */
+struct s_clint_timer_node
+{
+  /**
+  * @var s_clint_timer_node::p_next
+  * next in the slot list
+  */
+  struct s_clint_timer_node *p_next;
+  /**
+  * @var s_clint_timer_node::p_prev
+  * previous in the slot list
+  */
+  struct s_clint_timer_node *p_prev;
+};
+
+/**
+ * @struct s_clint_timer
+ * @brief A timer, memory is owned by the caller and must live while it is pending.
+ */
+struct s_clint_timer
+{
+  /**
+  * @var s_clint_timer::node
+  * wheel list links, must be first.
+  */
+  struct s_clint_timer_node node;
+  /**
+  * @var s_clint_timer::expire
+  * wheel tick the timer expires on
+  */
+  uint64_t expire;
+  /**
+  * @var s_clint_timer::period
+  * wheel ticks between expires, 0 for one shot.
+  */
+  uint64_t period;
+  /**
+  * @var s_clint_timer::callback
+  * function to call on expire
+  */
+  clint_timer_callback callback;
+  /**
+  * @var s_clint_timer::p_ctx
+  * passed to the callback
+  */
+  void *p_ctx;
+  /**
+  * @var s_clint_timer::level
+  * wheel level the timer is in
+  */
+  uint8_t level;
+  /**
+  * @var s_clint_timer::slot
+  * wheel slot the timer is in
+  */
+  uint8_t slot;
+  /**
+  * @var s_clint_timer::pending
+  * 1 if in the wheel
+  */
+  uint8_t pending;
+};
+
+/*********************************************//**
+  * @brief Initializes the timer service, no timers pending.
+  *
+  * Call serviceClintTimer from riscv_mtvec_mti and enable
+  * the machine timer irq to use it.
+  *
+  * @param p_clint pre-initialized struct from initClint
+  * @param gran_shift wheel tick is 2^gran_shift mtime ticks.
+  * Timers are rounded up to this. The wheel covers
+  * 2^(gran_shift+20) mtime ticks before it has to clamp.
+  *************************************************/
+void initClintTimer(struct s_clint *p_clint, uint8_t gran_shift);
+
+/*********************************************//**
+  * @brief start a one shot timer, restarts it if pending.
+  *
+  * @param p_timer caller owned timer
+  * @param delay mtime ticks from now, see calcMtimecmpMilliseconds.
+  * @param callback function to call on expire
+  * @param p_ctx passed to the callback
+  *************************************************/
+void setClintTimerOneshot(struct s_clint_timer *p_timer, uint64_t delay, clint_timer_callback callback, void *p_ctx);
+
+/*********************************************//**
+  * @brief start a periodic timer, restarts it if pending.
+  *
+  * @param p_timer caller owned timer
+  * @param period mtime ticks between expires, rounded up to the granularity.
+  * @param callback function to call on expire
+  * @param p_ctx passed to the callback
+  *************************************************/
+void setClintTimerPeriodic(struct s_clint_timer *p_timer, uint64_t period, clint_timer_callback callback, void *p_ctx);
+
+/*********************************************//**
+  * @brief cancel a timer, does nothing if it is not pending.
+  *
+  * @param p_timer caller owned timer
+  *************************************************/
+void clrClintTimer(struct s_clint_timer *p_timer);
+
+/*********************************************//**
+  * @brief check if a timer is pending.
+  *
+  * @param p_timer caller owned timer
+  *
+  * @return 1 if pending, 0 if not.
+  *************************************************/
+int isClintTimerPending(struct s_clint_timer *p_timer);
+
+/*********************************************//**
+  * @brief Run expired timers and program mtimecmp with
+  * the next deadline. Call from riscv_mtvec_mti.
+  *
+  * @return number of callbacks run
+  *************************************************/
+uint32_t serviceClintTimer(void);
+
+/*********************************************//**
+  * @brief wait for a condition or a timeout.
+  *
+  * If the timer service is initialized and machine
+  * interrupts are on the hart sleeps in wfi between
+  * checks, woken by any enabled interrupt (the device
+  * irq the condition depends on) or by a timer armed
+  * for the next poll or the timeout. Otherwise it
+  * spins on the condition and mtime.
+  *
+  * @param p_clint clint for mtime, NULL uses the one
+  * from initClintTimer, if neither the wait has no timeout.
+  * @param cond checked with interrupts off before each
+  * sleep, NULL waits for the full timeout.
+  * @param p_ctx passed to cond
+  * @param timeout mtime ticks or CLINT_WAIT_FOREVER
+  * @param poll mtime ticks between checks for conditions
+  * that have no interrupt, 0 to only wake on interrupts.
+  *
+  * @return 0 when the condition was met, 1 on timeout.
+  *************************************************/
+int waitClintTimer(struct s_clint *p_clint, clint_wait_cond cond, void *p_ctx, uint64_t timeout, uint64_t poll);
+
+/*********************************************//**
+  * @brief set a hook that waitClintTimer tries before
+  * sleeping, so a scheduler can run other tasks during
+  * driver waits. Only used while interrupts are on.
+  *
+  * @param yield hook, NULL to remove it.
+  *************************************************/
+void setClintTimerYield(clint_wait_yield yield);
+
+/*********************************************//**
+  * @brief sleep for a number of mtime ticks, see waitClintTimer.
+  *
+  * @param p_clint clint for mtime, NULL uses the one from initClintTimer.
+  * @param delay mtime ticks to sleep
+  *************************************************/
+void sleepClintTimer(struct s_clint *p_clint, uint64_t delay);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -31,9 +31,43 @@
   *****************************************************************************/
 
 #include <stdlib.h>
+#include <string.h>
+
+#include <riscv-csr.h>
+#include <irq/nested-irq.h>
 
 #include "plic.h"
 
+// word offsets from the plic base
+#define PLIC_PRIORITY_WORD  (0x000000/sizeof(uint32_t))
+#define PLIC_PENDING_WORD   (0x001000/sizeof(uint32_t))
+#define PLIC_ENABLE_WORD    (0x002000/sizeof(uint32_t))
+
+// get the plic registers as an array of words
+#define PLIC_REGS(p_plic)   ((volatile uint32_t *)(p_plic))
+
+/**
+ * @struct s_plic_source
+ * @brief registered handler for a source
+ */
+struct s_plic_source
+{
+  plic_handler handler;
+  void *p_ctx;
+  uint32_t prio;
+};
+
+static struct
+{
+  struct s_plic *p_plic;
+  uint32_t enable[PLIC_NUM_WORDS];
+  uint32_t unhandled;
+  struct s_plic_source sources[PLIC_NUM_SOURCES];
+} g_plic_dispatch;
+
+// set or clear one source in the enable shadow and write its word
+static void writeEnableBit(struct s_plic *p_plic, uint32_t id, int enable);
+
 // Initializes plic structure and device
 struct s_plic *initPlic(uint32_t memory_address)
 {
@@ -41,3 +75,295 @@ struct s_plic *initPlic(uint32_t memory_address)
 
   return p_temp;
 }
+
+// set the priority of a source
+void plicSetPriority(struct s_plic *p_plic, uint32_t id, uint32_t prio)
+{
+  if(!p_plic) return;
+
+  if(!id || (id >= PLIC_NUM_SOURCES)) return;
+
+  PLIC_REGS(p_plic)[PLIC_PRIORITY_WORD + id] = prio;
+}
+
+// get the priority of a source
+uint32_t plicGetPriority(struct s_plic *p_plic, uint32_t id)
+{
+  if(!p_plic) return 0;
+
+  if(!id || (id >= PLIC_NUM_SOURCES)) return 0;
+
+  return PLIC_REGS(p_plic)[PLIC_PRIORITY_WORD + id];
+}
+
+// enable a source
+void plicEnable(struct s_plic *p_plic, uint32_t id)
+{
+  if(!p_plic) return;
+
+  if(!id || (id >= PLIC_NUM_SOURCES)) return;
+
+  writeEnableBit(p_plic, id, 1);
+}
+
+// disable a source
+void plicDisable(struct s_plic *p_plic, uint32_t id)
+{
+  if(!p_plic) return;
+
+  if(!id || (id >= PLIC_NUM_SOURCES)) return;
+
+  writeEnableBit(p_plic, id, 0);
+}
+
+// write a whole enable word
+void plicEnableMask(struct s_plic *p_plic, uint32_t word_idx, uint32_t mask)
+{
+  if(!p_plic) return;
+
+  if(word_idx >= PLIC_NUM_WORDS) return;
+
+  // keep the shadow in step, single source changes are built from it.
+  g_plic_dispatch.enable[word_idx] = mask;
+
+  PLIC_REGS(p_plic)[PLIC_ENABLE_WORD + word_idx] = mask;
+}
+
+// read a whole enable word
+uint32_t plicGetEnableMask(struct s_plic *p_plic, uint32_t word_idx)
+{
+  if(!p_plic) return 0;
+
+  if(word_idx >= PLIC_NUM_WORDS) return 0;
+
+  return PLIC_REGS(p_plic)[PLIC_ENABLE_WORD + word_idx];
+}
+
+// read a whole pending word
+uint32_t plicGetPendingMask(struct s_plic *p_plic, uint32_t word_idx)
+{
+  if(!p_plic) return 0;
+
+  if(word_idx >= PLIC_NUM_WORDS) return 0;
+
+  return PLIC_REGS(p_plic)[PLIC_PENDING_WORD + word_idx];
+}
+
+// set the priority threshold
+void plicSetThreshold(struct s_plic *p_plic, uint32_t threshold)
+{
+  if(!p_plic) return;
+
+  p_plic->threshold = threshold;
+}
+
+// get the priority threshold
+uint32_t plicGetThreshold(struct s_plic *p_plic)
+{
+  if(!p_plic) return 0;
+
+  return p_plic->threshold;
+}
+
+// claim the highest priority pending source
+uint32_t plicClaim(struct s_plic *p_plic)
+{
+  if(!p_plic) return 0;
+
+  return p_plic->claim;
+}
+
+// complete a claimed source
+void plicComplete(struct s_plic *p_plic, uint32_t id)
+{
+  if(!p_plic) return;
+
+  p_plic->claim = id;
+}
+
+// Initializes the plic dispatcher
+void initPlicDispatch(struct s_plic *p_plic)
+{
+  int index;
+
+  if(!p_plic) return;
+
+  memset(&g_plic_dispatch, 0, sizeof(g_plic_dispatch));
+
+  g_plic_dispatch.p_plic = p_plic;
+
+  // whole words at a time, no bit field read modify writes.
+  for(index = 0; index < PLIC_NUM_WORDS; index++)
+  {
+    plicEnableMask(p_plic, index, 0);
+  }
+
+  for(index = 1; index < PLIC_NUM_SOURCES; index++)
+  {
+    plicSetPriority(p_plic, index, 0);
+  }
+
+  plicSetThreshold(p_plic, 0);
+}
+
+// Register a handler for a plic source
+int plicRegister(uint32_t source, uint32_t prio, plic_handler handler, void *p_ctx)
+{
+  struct s_plic *p_plic = g_plic_dispatch.p_plic;
+
+  if(!p_plic) return 1;
+
+  if(!handler) return 1;
+
+  if(!source || (source >= PLIC_NUM_SOURCES)) return 1;
+
+  if(!prio || (prio > PLIC_MAX_PRIORITY)) return 1;
+
+  g_plic_dispatch.sources[source].handler = handler;
+  g_plic_dispatch.sources[source].p_ctx   = p_ctx;
+  g_plic_dispatch.sources[source].prio    = prio;
+
+  plicSetPriority(p_plic, source, prio);
+
+  writeEnableBit(p_plic, source, 1);
+
+  return 0;
+}
+
+// Disable a plic source and remove its handler
+void plicUnregister(uint32_t source)
+{
+  struct s_plic *p_plic = g_plic_dispatch.p_plic;
+
+  if(!p_plic) return;
+
+  if(!source || (source >= PLIC_NUM_SOURCES)) return;
+
+  writeEnableBit(p_plic, source, 0);
+
+  plicSetPriority(p_plic, source, 0);
+
+  g_plic_dispatch.sources[source].handler = NULL;
+  g_plic_dispatch.sources[source].p_ctx   = NULL;
+  g_plic_dispatch.sources[source].prio    = 0;
+}
+
+// Claim and handle plic sources until none are pending
+uint32_t plicDispatch(void)
+{
+  uint32_t count = 0;
+  uint32_t source;
+
+  struct s_plic *p_plic = g_plic_dispatch.p_plic;
+
+  if(!p_plic) return 0;
+
+  // drain everything pending in one trap instead of taking a trap per source.
+  while((source = plicClaim(p_plic)) != 0)
+  {
+    struct s_plic_source *p_source = NULL;
+
+    if(source < PLIC_NUM_SOURCES) p_source = &g_plic_dispatch.sources[source];
+
+    if(p_source && p_source->handler)
+    {
+      p_source->handler(source, p_source->p_ctx);
+    }
+    else
+    {
+      // nobody wants it, turn it off so it can not storm.
+      g_plic_dispatch.unhandled++;
+
+      plicUnregister(source);
+    }
+
+    plicComplete(p_plic, source);
+
+    count++;
+  }
+
+  return count;
+}
+
+// Claim and handle plic sources with preemption by higher priorities
+uint32_t plicDispatchNested(void)
+{
+  uint32_t count = 0;
+  uint32_t source;
+  uint32_t threshold;
+
+  uint_xlen_t mepc;
+  uint_xlen_t mstatus;
+
+  struct s_plic *p_plic = g_plic_dispatch.p_plic;
+
+  if(!p_plic) return 0;
+
+  // a nested trap overwrites these, put them back before the mret.
+  mepc    = csr_read_mepc();
+  mstatus = csr_read_mstatus();
+
+  threshold = plicGetThreshold(p_plic);
+
+  while((source = plicClaim(p_plic)) != 0)
+  {
+    struct s_plic_source *p_source = NULL;
+
+    if(source < PLIC_NUM_SOURCES) p_source = &g_plic_dispatch.sources[source];
+
+    if(p_source && p_source->handler)
+    {
+      // only sources above this one may interrupt it.
+      plicSetThreshold(p_plic, p_source->prio);
+
+      // read back so the threshold has landed before interrupts are on.
+      (void)plicGetThreshold(p_plic);
+
+      // counted like NESTED_IRQ_ENTER, so a blocking driver call in the handler does not yield.
+      (*nestedIrqDepth())++;
+
+      csr_set_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+
+      p_source->handler(source, p_source->p_ctx);
+
+      csr_clr_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+
+      (*nestedIrqDepth())--;
+
+      plicSetThreshold(p_plic, threshold);
+    }
+    else
+    {
+      g_plic_dispatch.unhandled++;
+
+      plicUnregister(source);
+    }
+
+    plicComplete(p_plic, source);
+
+    count++;
+  }
+
+  csr_write_mepc(mepc);
+  csr_write_mstatus(mstatus);
+
+  return count;
+}
+
+// set or clear one source in the enable shadow and write its word
+static void writeEnableBit(struct s_plic *p_plic, uint32_t id, int enable)
+{
+  uint32_t mask = g_plic_dispatch.enable[id/32];
+
+  // shadow copy of the enables, one write and no read of the plic.
+  if(enable)
+  {
+    mask |= (1UL << (id % 32));
+  }
+  else
+  {
+    mask &= ~(1UL << (id % 32));
+  }
+
+  plicEnableMask(p_plic, id/32, mask);
+}
@@ -35,10 +35,20 @@
 
 #include <stdint.h>
 
+#define PLIC_NUM_SOURCES      128
+#define PLIC_NUM_WORDS        (PLIC_NUM_SOURCES/32)
+#define PLIC_MAX_PRIORITY     7
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @typedef plic_handler
+ * @brief handler called by plicDispatch for a claimed source.
+ */
+typedef void (*plic_handler)(uint32_t source, void *p_ctx);
+
 /**
  * @struct s_plic
  * @brief A struct to use for various plic devices. Will get memory mapped by init.
@@ -2164,6 +2174,152 @@ struct s_plic
   *************************************************/
 struct s_plic *initPlic(uint32_t memory_address);
 
+/*********************************************//**
+  * @brief set the priority of a source.
+  *
+  * @param p_plic pre-initialized struct from initPlic
+  * @param id plic source number, 1 to 127.
+  * @param prio priority, 0 (never) to PLIC_MAX_PRIORITY.
+  *************************************************/
+void plicSetPriority(struct s_plic *p_plic, uint32_t id, uint32_t prio);
+
+/*********************************************//**
+  * @brief get the priority of a source.
+  *
+  * @param p_plic pre-initialized struct from initPlic
+  * @param id plic source number, 1 to 127.
+  *
+  * @return priority of the source, 0 on error.
+  *************************************************/
+uint32_t plicGetPriority(struct s_plic *p_plic, uint32_t id);
+
+/*********************************************//**
+  * @brief enable a source.
+  *
+  * @param p_plic pre-initialized struct from initPlic
+  * @param id plic source number, 1 to 127.
+  *************************************************/
+void plicEnable(struct s_plic *p_plic, uint32_t id);
+
+/*********************************************//**
+  * @brief disable a source.
+  *
+  * @param p_plic pre-initialized struct from initPlic
+  * @param id plic source number, 1 to 127.
+  *************************************************/
+void plicDisable(struct s_plic *p_plic, uint32_t id);
+
+/*********************************************//**
+  * @brief write a whole enable word, 32 sources at once.
+  *
+  * @param p_plic pre-initialized struct from initPlic
+  * @param word_idx enable word, 0 to PLIC_NUM_WORDS-1. Word 0 is sources 0 to 31.
+  * @param mask bit per source, 1 is enabled.
+  *************************************************/
+void plicEnableMask(struct s_plic *p_plic, uint32_t word_idx, uint32_t mask);
+
+/*********************************************//**
+  * @brief read a whole enable word, 32 sources at once.
+  *
+  * @param p_plic pre-initialized struct from initPlic
+  * @param word_idx enable word, 0 to PLIC_NUM_WORDS-1.
+  *
+  * @return bit per source, 1 is enabled.
+  *************************************************/
+uint32_t plicGetEnableMask(struct s_plic *p_plic, uint32_t word_idx);
+
+/*********************************************//**
+  * @brief read a whole pending word, 32 sources at once.
+  *
+  * @param p_plic pre-initialized struct from initPlic
+  * @param word_idx pending word, 0 to PLIC_NUM_WORDS-1.
+  *
+  * @return bit per source, 1 is pending.
+  *************************************************/
+uint32_t plicGetPendingMask(struct s_plic *p_plic, uint32_t word_idx);
+
+/*********************************************//**
+  * @brief set the priority threshold, sources at or below
+  * it will not interrupt.
+  *
+  * @param p_plic pre-initialized struct from initPlic
+  * @param threshold 0 to PLIC_MAX_PRIORITY.
+  *************************************************/
+void plicSetThreshold(struct s_plic *p_plic, uint32_t threshold);
+
+/*********************************************//**
+  * @brief get the priority threshold.
+  *
+  * @param p_plic pre-initialized struct from initPlic
+  *
+  * @return current threshold.
+  *************************************************/
+uint32_t plicGetThreshold(struct s_plic *p_plic);
+
+/*********************************************//**
+  * @brief claim the highest priority pending source.
+  *
+  * @param p_plic pre-initialized struct from initPlic
+  *
+  * @return source number, 0 for none.
+  *************************************************/
+uint32_t plicClaim(struct s_plic *p_plic);
+
+/*********************************************//**
+  * @brief complete a claimed source.
+  *
+  * @param p_plic pre-initialized struct from initPlic
+  * @param id source number returned by plicClaim.
+  *************************************************/
+void plicComplete(struct s_plic *p_plic, uint32_t id);
+
+/*********************************************//**
+  * @brief Initializes the plic dispatcher, all sources
+  * are disabled with priority 0 and the threshold is 0.
+  *
+  * @param p_plic pre-initialized struct from initPlic
+  *************************************************/
+void initPlicDispatch(struct s_plic *p_plic);
+
+/*********************************************//**
+  * @brief Register a handler for a plic source, set
+  * its priority and enable it.
+  *
+  * @param source plic source number, 1 to 127.
+  * @param prio priority, 1 to PLIC_MAX_PRIORITY.
+  * @param handler function called when source is claimed.
+  * @param p_ctx pointer passed to the handler.
+  *
+  * @return 0 on success, 1 on error.
+  *************************************************/
+int plicRegister(uint32_t source, uint32_t prio, plic_handler handler, void *p_ctx);
+
+/*********************************************//**
+  * @brief Disable a plic source and remove its handler.
+  *
+  * @param source plic source number, 1 to 127.
+  *************************************************/
+void plicUnregister(uint32_t source);
+
+/*********************************************//**
+  * @brief Claim and handle plic sources until none are
+  * pending. Call from riscv_mtvec_mei.
+  *
+  * @return number of sources handled.
+  *************************************************/
+uint32_t plicDispatch(void);
+
+/*********************************************//**
+  * @brief Same as plicDispatch but handlers run with
+  * interrupts on and the threshold raised to the claimed
+  * source priority, so only higher priority sources (and
+  * the CLINT timer/software irqs if enabled in mie) can
+  * preempt them. Call from riscv_mtvec_mei.
+  *
+  * @return number of sources handled.
+  *************************************************/
+uint32_t plicDispatchNested(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,139 @@
+/***************************************************************************//**
+  * @file     uart_map.h
+  * @brief    NS16550 UART register map
+  * @details  Byte wide register layout (reg-shift 0) of the 16550 compatible UART in QEMU virt.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __UART_MAP_H
+#define __UART_MAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// FCR bits
+#define UART_FCR_FIFO_EN    0x01
+#define UART_FCR_RX_RST     0x02
+#define UART_FCR_TX_RST     0x04
+
+// LCR bits
+#define UART_LCR_8N1        0x03
+#define UART_LCR_DLAB       0x80
+
+// IER bits
+#define UART_IER_RX_DATA    0x01
+
+// LSR bits
+#define UART_LSR_DR         0x01
+#define UART_LSR_OE         0x02
+#define UART_LSR_PE         0x04
+#define UART_LSR_FE         0x08
+#define UART_LSR_THRE       0x20
+#define UART_LSR_TEMT       0x40
+
+/**
+ * @struct s_uart
+ * @brief A struct to use for various uart devices. Will get memory mapped by init.
+ */
+struct s_uart
+{
+  /**
+  * @union u_data
+  * @brief receive buffer on read, transmit holding on write.
+  */
+  union
+  {
+    /**
+    * @var s_uart:u_data:rbr
+    * receive buffer
+    */
+    volatile uint8_t rbr;
+    /**
+    * @var s_uart:u_data:thr
+    * transmit holding
+    */
+    volatile uint8_t thr;
+  } data;
+  /**
+  * @var s_uart::ier
+  * interrupt enable
+  */
+  volatile uint8_t ier;
+  /**
+  * @union u_fifo
+  * @brief interrupt identification on read, fifo control on write.
+  */
+  union
+  {
+    /**
+    * @var s_uart:u_fifo:iir
+    * interrupt identification
+    */
+    volatile uint8_t iir;
+    /**
+    * @var s_uart:u_fifo:fcr
+    * fifo control
+    */
+    volatile uint8_t fcr;
+  } fifo;
+  /**
+  * @var s_uart::lcr
+  * line control
+  */
+  volatile uint8_t lcr;
+  /**
+  * @var s_uart::mcr
+  * modem control
+  */
+  volatile uint8_t mcr;
+  /**
+  * @var s_uart::lsr
+  * line status
+  */
+  volatile uint8_t lsr;
+  /**
+  * @var s_uart::msr
+  * modem status
+  */
+  volatile uint8_t msr;
+  /**
+  * @var s_uart::scr
+  * scratch
+  */
+  volatile uint8_t scr;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
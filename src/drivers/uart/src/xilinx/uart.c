@@ -96,7 +96,7 @@ int recvUartString(struct s_uart *p_uart, char *p_string, int len)
 
     p_string[index] = getUartRxData(p_uart);
 
-    if((p_string[index] == '\r') && (p_string[index-1] == '\n'))
+    if((index > 0) && (p_string[index] == '\r') && (p_string[index-1] == '\n'))
     {
       p_string[index-1] = '\0';
 
@@ -41,6 +41,58 @@ extern "C" {
 #include <stdint.h>
 #include "uart_map.h"
 
+/**
+ * @def UART_LINE_RING_SIZE
+ * Size of the line receive ring buffer in bytes, must be a power of 2.
+ */
+#ifndef UART_LINE_RING_SIZE
+#define UART_LINE_RING_SIZE 256
+#endif
+
+/**
+ * @def UART_LINE_MAX
+ * Max size of an assembled line, including the null terminator.
+ */
+#ifndef UART_LINE_MAX
+#define UART_LINE_MAX       128
+#endif
+
+/**
+ * @def UART_LINE_POLL_TICKS
+ * mtime ticks between rx fifo checks while recvUartLine sleeps,
+ * it wakes sooner on the uart irq if that is enabled.
+ */
+#ifndef UART_LINE_POLL_TICKS
+#define UART_LINE_POLL_TICKS 4096
+#endif
+
+#define UART_LINE_NONE      0
+#define UART_LINE_TIMEOUT   -1
+
+struct s_clint;
+
+/**
+ * @struct s_uart_line
+ * @brief Line receive state, ring buffer filled from the uart rx fifo and
+ * the line being assembled from it. irq is set by setUartLineIrq when the
+ * uart irq is the only caller of fillUartLine.
+ */
+struct s_uart_line
+{
+  struct s_uart   *p_uart;
+  struct s_clint  *p_clint;
+  const char      *p_term;
+  uint64_t        timeout;
+  uint64_t        last_rx;
+  uint32_t        dropped;
+  volatile uint16_t head;
+  volatile uint16_t tail;
+  uint16_t        line_len;
+  uint8_t         irq;
+  uint8_t         ring[UART_LINE_RING_SIZE];
+  char            line[UART_LINE_MAX];
+};
+
 /*********************************************//**
   * @brief Initializes uart structure and device
   * to defaults, no IRQ, clear all fifos.
@@ -171,6 +223,69 @@ void setUartIntrEna(struct s_uart *p_uart);
   *************************************************/
 void unsetUartIntrEna(struct s_uart *p_uart);
 
+/*********************************************//**
+  * @brief Initializes uart line receive state.
+  *
+  * @param p_line pre-allocated struct for the line state.
+  * @param p_uart pre-initialized struct from initUart
+  * @param p_clint pre-initialized struct from initClint, used
+  * for the timeout. NULL disables the timeout.
+  * @param p_term string of characters that end a line, any one of
+  * them terminates. NULL selects the default "\n\r".
+  * @param timeout number of clint ticks without a received byte
+  * before a partial line is dropped, 0 for none.
+  *************************************************/
+void initUartLine(struct s_uart_line *p_line, struct s_uart *p_uart, struct s_clint *p_clint, const char *p_term, uint64_t timeout);
+
+/*********************************************//**
+  * @brief Move all bytes in the uart rx fifo into
+  * the line ring buffer. Safe to call from the uart
+  * irq handler, bytes are dropped if the ring is full.
+  *
+  * @param p_line pre-initialized struct from initUartLine
+  *
+  * @return number of bytes moved.
+  *************************************************/
+int fillUartLine(struct s_uart_line *p_line);
+
+/*********************************************//**
+  * @brief Select who fills the ring. The ring has one
+  * producer, with irq set pollUartLine leaves the rx
+  * fifo to fillUartLine in the uart irq handler and
+  * recvUartLine waits on the ring instead of the fifo.
+  *
+  * @param p_line pre-initialized struct from initUartLine
+  * @param irq 1 if the uart irq calls fillUartLine, 0
+  * (the default) for pollUartLine to call it.
+  *************************************************/
+void setUartLineIrq(struct s_uart_line *p_line, int irq);
+
+/*********************************************//**
+  * @brief Non-blocking check for a completed line.
+  *
+  * @param p_line pre-initialized struct from initUartLine
+  * @param p_string String for storage, null terminated.
+  * @param len max length the buffer can support.
+  *
+  * @return length of the line without terminator,
+  * UART_LINE_NONE if no line is complete yet, or
+  * UART_LINE_TIMEOUT if a partial line timed out.
+  *************************************************/
+int pollUartLine(struct s_uart_line *p_line, char *p_string, int len);
+
+/*********************************************//**
+  * @brief Blocking read of a line, gives up after
+  * the timeout passes with no byte received.
+  *
+  * @param p_line pre-initialized struct from initUartLine
+  * @param p_string String for storage, null terminated.
+  * @param len max length the buffer can support.
+  *
+  * @return length of the line without terminator or
+  * UART_LINE_TIMEOUT.
+  *************************************************/
+int recvUartLine(struct s_uart_line *p_line, char *p_string, int len);
+
 #ifdef __cplusplus
 }
 #endif
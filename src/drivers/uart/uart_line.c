@@ -0,0 +1,228 @@
+/***************************************************************************//**
+  * @file     uart_line.c
+  * @brief    UART line receive
+  * @details  Ring buffered line discipline on top of the uart driver interface.
+  *           Only uses uart.h functions so it works for any uart target.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <clint.h>
+#include <clint_timer.h>
+
+#include "uart.h"
+
+#define UART_LINE_RING_MASK (UART_LINE_RING_SIZE-1)
+
+static const char c_DEFAULT_TERM[] = "\n\r";
+
+// copy assembled line out to the user and reset it
+static int copyLine(struct s_uart_line *p_line, char *p_string, int len);
+// wait condition for recvUartLine
+static int uartRxReady(void *p_ctx);
+
+// Initializes uart line receive state
+void initUartLine(struct s_uart_line *p_line, struct s_uart *p_uart, struct s_clint *p_clint, const char *p_term, uint64_t timeout)
+{
+  if(!p_line) return;
+
+  memset(p_line, 0, sizeof(struct s_uart_line));
+
+  p_line->p_uart  = p_uart;
+  p_line->p_clint = p_clint;
+  p_line->p_term  = (p_term ? p_term : c_DEFAULT_TERM);
+  p_line->timeout = (p_clint ? timeout : 0);
+
+  if(p_clint) p_line->last_rx = getClintMTime(p_clint);
+}
+
+// Move all bytes in the uart rx fifo into the line ring buffer
+int fillUartLine(struct s_uart_line *p_line)
+{
+  int count = 0;
+
+  uint16_t head;
+
+  if(!p_line) return 0;
+
+  head = p_line->head;
+
+  while(getUartRxFifoValid(p_line->p_uart) == 1)
+  {
+    uint8_t data = getUartRxData(p_line->p_uart);
+
+    // full, keep draining the fifo so the irq clears but drop the data.
+    if(((head + 1) & UART_LINE_RING_MASK) == p_line->tail)
+    {
+      p_line->dropped++;
+      continue;
+    }
+
+    p_line->ring[head] = data;
+
+    head = (head + 1) & UART_LINE_RING_MASK;
+
+    count++;
+  }
+
+  p_line->head = head;
+
+  return count;
+}
+
+// Select who fills the ring
+void setUartLineIrq(struct s_uart_line *p_line, int irq)
+{
+  if(!p_line) return;
+
+  p_line->irq = (irq != 0);
+}
+
+// Non-blocking check for a completed line
+int pollUartLine(struct s_uart_line *p_line, char *p_string, int len)
+{
+  uint16_t tail;
+
+  if(!p_line)   return UART_LINE_NONE;
+  if(!p_string) return UART_LINE_NONE;
+
+  if(len <= 0)  return UART_LINE_NONE;
+
+  // head has one producer, leave the fifo to the irq when it fills the ring.
+  if(!p_line->irq) fillUartLine(p_line);
+
+  tail = p_line->tail;
+
+  if(tail != p_line->head)
+  {
+    if(p_line->timeout) p_line->last_rx = getClintMTime(p_line->p_clint);
+
+    while(tail != p_line->head)
+    {
+      char data = (char)p_line->ring[tail];
+
+      tail = (tail + 1) & UART_LINE_RING_MASK;
+
+      if(data && strchr(p_line->p_term, data))
+      {
+        // back to back terminators (\n\r) would be an empty line, skip them.
+        if(!p_line->line_len) continue;
+
+        p_line->tail = tail;
+
+        return copyLine(p_line, p_string, len);
+      }
+
+      p_line->line[p_line->line_len++] = data;
+
+      // no room left for more, hand back what we have as a line.
+      if(p_line->line_len >= (UART_LINE_MAX - 1))
+      {
+        p_line->tail = tail;
+
+        return copyLine(p_line, p_string, len);
+      }
+    }
+
+    p_line->tail = tail;
+
+    return UART_LINE_NONE;
+  }
+
+  if(!p_line->timeout) return UART_LINE_NONE;
+
+  if(!p_line->line_len) return UART_LINE_NONE;
+
+  if((getClintMTime(p_line->p_clint) - p_line->last_rx) < p_line->timeout) return UART_LINE_NONE;
+
+  // half typed line went stale, drop it.
+  p_line->line_len = 0;
+
+  return UART_LINE_TIMEOUT;
+}
+
+// Blocking read of a line
+int recvUartLine(struct s_uart_line *p_line, char *p_string, int len)
+{
+  int result;
+  uint64_t elapsed;
+
+  if(!p_line) return UART_LINE_TIMEOUT;
+
+  if(p_line->timeout) p_line->last_rx = getClintMTime(p_line->p_clint);
+
+  for(;;)
+  {
+    result = pollUartLine(p_line, p_string, len);
+
+    if(result != UART_LINE_NONE) return result;
+
+    if(!p_line->timeout)
+    {
+      waitClintTimer(p_line->p_clint, uartRxReady, p_line, CLINT_WAIT_FOREVER, UART_LINE_POLL_TICKS);
+      continue;
+    }
+
+    elapsed = getClintMTime(p_line->p_clint) - p_line->last_rx;
+
+    // nothing at all showed up
+    if(elapsed >= p_line->timeout) return UART_LINE_TIMEOUT;
+
+    // sleep until the next byte or the rest of the timeout.
+    waitClintTimer(p_line->p_clint, uartRxReady, p_line, p_line->timeout - elapsed, UART_LINE_POLL_TICKS);
+  }
+}
+
+// copy assembled line out to the user and reset it
+static int copyLine(struct s_uart_line *p_line, char *p_string, int len)
+{
+  int line_len = p_line->line_len;
+
+  if(line_len > (len - 1)) line_len = len - 1;
+
+  memcpy(p_string, p_line->line, line_len);
+
+  p_string[line_len] = '\0';
+
+  p_line->line_len = 0;
+
+  return line_len;
+}
+
+// wait condition for recvUartLine
+static int uartRxReady(void *p_ctx)
+{
+  struct s_uart_line *p_line = (struct s_uart_line *)p_ctx;
+
+  if(p_line->irq) return (p_line->head != p_line->tail);
+
+  return getUartRxFifoValid(p_line->p_uart);
+}
@@ -1,7 +1,7 @@
 /***************************************************************************//**
   * @file     bmpm.c
   * @brief    bitmap to raw conversion
-  * @details  Convert 32bit XA8R8G8B images to RAW 32bit images, flips lines.
+  * @details  Convert 32, 24, 16 and 8 bit (RLE8) bitmaps to RAW 32bit XA8R8G8B images, flips lines.
   * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
   * @date     01/13/2026
   * @version
@@ -35,42 +35,273 @@
 #include <string.h>
 #include "bmpm.h"
 
-struct
-{
-  signed int width;
-  signed int height;
-  uint16_t depth;
-  uint32_t offset;
-} g_bmp_data;
+// word loads from byte buffers, the row data is only ever read through these.
+typedef uint32_t __attribute__((may_alias)) bmpm_word;
+
+// rle8 decoder states
+enum e_rle_state {RLE_COUNT, RLE_RUN, RLE_ESCAPE, RLE_DELTA_X, RLE_DELTA_Y, RLE_ABSOLUTE, RLE_PAD, RLE_END};
 
 //helper functions
 //detects bitmap image, if it exists and is of the right type
-//this will return the offset, if its not a 24 bit bitmap -1, raw data, 0
-uint32_t detectBMP(void const *p_data, uint32_t len);
+//this will return the offset, if its not a supported bitmap, or raw data, 0
+uint32_t detectBMP(struct s_bmpm_ctx *p_bmpm, void const *p_data, uint32_t len);
 //swaps rows, as bitmap reverse the bits
 //0 success, -1 failure
 int reverseData(void *op_data, uint32_t len, signed int width, signed int height);
+//start a stream once the output is set
+static uint32_t streamBegin(struct s_bmpm_ctx *p_bmpm, void const *p_data, uint32_t len);
+
+#if BMPM_SHARED_CTX
+// context for the calls that do not take one.
+static struct s_bmpm_ctx g_bmpm_ctx;
+
+// calls without a context, all on the shared one.
+//convert bitmap data to RAW
+uint32_t bmpmConvertToRaw(void **op_data, uint32_t len)
+{
+  return bmpmCtxConvertToRaw(&g_bmpm_ctx, op_data, len);
+}
+
+//return width
+signed int bmpmGetWidth()
+{
+  return bmpmCtxGetWidth(&g_bmpm_ctx);
+}
+
+//return height
+signed int bmpmGetHeight()
+{
+  return bmpmCtxGetHeight(&g_bmpm_ctx);
+}
+
+// return header offset of the last converted bitmap
+uint32_t bmpmGetOffset()
+{
+  return bmpmCtxGetOffset(&g_bmpm_ctx);
+}
+
+// return bits per pixel of the last converted bitmap
+uint16_t bmpmGetDepth()
+{
+  return bmpmCtxGetDepth(&g_bmpm_ctx);
+}
+
+// start streaming a bitmap into a framebuffer
+uint32_t bmpmStreamBegin(void const *p_data, uint32_t len, uint32_t *p_dest, uint32_t dest_stride, uint32_t dest_width, uint32_t dest_height)
+{
+  return bmpmCtxStreamBegin(&g_bmpm_ctx, p_data, len, p_dest, dest_stride, dest_width, dest_height);
+}
+
+// start streaming a bitmap to a row callback
+uint32_t bmpmStreamBeginRows(void const *p_data, uint32_t len, bmpm_row_fn row_fn, void *p_ctx)
+{
+  return bmpmCtxStreamBeginRows(&g_bmpm_ctx, p_data, len, row_fn, p_ctx);
+}
+
+// write the next chunk of the file
+uint32_t bmpmStreamData(void const *p_data, uint32_t len)
+{
+  return bmpmCtxStreamData(&g_bmpm_ctx, p_data, len);
+}
+
+// bytes in one row of the bitmap being streamed
+uint32_t bmpmStreamRowBytes()
+{
+  return bmpmCtxStreamRowBytes(&g_bmpm_ctx);
+}
+
+// bytes to read next so later reads start on a row
+uint32_t bmpmStreamChunkBytes()
+{
+  return bmpmCtxStreamChunkBytes(&g_bmpm_ctx);
+}
+#endif
+
+// read a little endian field from the header
+static uint32_t readLE(uint8_t const *p_data, uint8_t bytes)
+{
+  uint32_t value = 0;
+  
+  while(bytes--) value = (value << 8) | p_data[bytes];
+  
+  return value;
+}
+
+// 32 bit rows are already a8r8g8b8
+static void convertRow32(uint32_t *p_out, uint8_t const *p_in, uint32_t width, uint32_t const *p_palette)
+{
+  (void)p_palette;
+  
+  memcpy(p_out, p_in, width * sizeof(uint32_t));
+}
+
+// 24 bit, 4 pixels are 3 words. b0g0r0b1 g1r1b2g2 r2b3g3r3 becomes 4 words.
+static void convertRow24(uint32_t *p_out, uint8_t const *p_in, uint32_t width, uint32_t const *p_palette)
+{
+  (void)p_palette;
+  
+  if(!((uintptr_t)p_in & 3))
+  {
+    bmpm_word const *p_word = (bmpm_word const *)p_in;
+    
+    for(; width >= 4; width -= 4)
+    {
+      uint32_t w0 = p_word[0];
+      uint32_t w1 = p_word[1];
+      uint32_t w2 = p_word[2];
+      
+      p_out[0] = w0 & 0x00FFFFFF;
+      p_out[1] = (w0 >> 24) | ((w1 & 0x0000FFFF) << 8);
+      p_out[2] = (w1 >> 16) | ((w2 & 0x000000FF) << 16);
+      p_out[3] = w2 >> 8;
+      
+      p_word += 3;
+      p_out  += 4;
+    }
+    
+    p_in = (uint8_t const *)p_word;
+  }
+  
+  for(; width; width--)
+  {
+    *p_out++ = (uint32_t)p_in[0] | ((uint32_t)p_in[1] << 8) | ((uint32_t)p_in[2] << 16);
+    
+    p_in += 3;
+  }
+}
+
+// expand two 16 bit pixels side by side in one word, 5/6 bit channels are replicated into 8 bits.
+static inline void expand16(uint32_t *p_out, uint32_t word, uint8_t is_565)
+{
+  uint32_t r = (word >> (is_565 ? 11 : 10)) & 0x001F001F;
+  uint32_t g = (word >> 5) & (is_565 ? 0x003F003F : 0x001F001F);
+  uint32_t b = word & 0x001F001F;
+  
+  // the >> pulls lane 1 bits into the top of lane 0, the mask drops them.
+  r = ((r << 3) | (r >> 2)) & 0x00FF00FF;
+  g = (is_565 ? ((g << 2) | (g >> 4)) : ((g << 3) | (g >> 2))) & 0x00FF00FF;
+  b = ((b << 3) | (b >> 2)) & 0x00FF00FF;
+  
+  p_out[0] = ((r & 0xFF) << 16) | ((g & 0xFF) << 8) | (b & 0xFF);
+  p_out[1] = (r & 0x00FF0000) | ((g >> 8) & 0x0000FF00) | (b >> 16);
+}
+
+// 16 bit rows, 2 pixels per word.
+static inline void convertRow16(uint32_t *p_out, uint8_t const *p_in, uint32_t width, uint8_t is_565)
+{
+  uint32_t tail[2];
+  
+  if(!((uintptr_t)p_in & 3))
+  {
+    bmpm_word const *p_word = (bmpm_word const *)p_in;
+    
+    for(; width >= 2; width -= 2)
+    {
+      expand16(p_out, *p_word++, is_565);
+      
+      p_out += 2;
+    }
+    
+    p_in = (uint8_t const *)p_word;
+  }
+  
+  for(; width; width--)
+  {
+    expand16(tail, (uint32_t)p_in[0] | ((uint32_t)p_in[1] << 8), is_565);
+    
+    *p_out++ = tail[0];
+    
+    p_in += 2;
+  }
+}
+
+// 16 bit r5g6b5
+static void convertRow565(uint32_t *p_out, uint8_t const *p_in, uint32_t width, uint32_t const *p_palette)
+{
+  (void)p_palette;
+  
+  convertRow16(p_out, p_in, width, 1);
+}
 
+// 16 bit x1r5g5b5
+static void convertRow555(uint32_t *p_out, uint8_t const *p_in, uint32_t width, uint32_t const *p_palette)
+{
+  (void)p_palette;
+  
+  convertRow16(p_out, p_in, width, 0);
+}
+
+// 8 bit palette index, 4 indexes per word.
+static void convertRow8(uint32_t *p_out, uint8_t const *p_in, uint32_t width, uint32_t const *p_palette)
+{
+  if(!((uintptr_t)p_in & 3))
+  {
+    bmpm_word const *p_word = (bmpm_word const *)p_in;
+    
+    for(; width >= 4; width -= 4)
+    {
+      uint32_t word = *p_word++;
+      
+      p_out[0] = p_palette[word & 0xFF];
+      p_out[1] = p_palette[(word >> 8) & 0xFF];
+      p_out[2] = p_palette[(word >> 16) & 0xFF];
+      p_out[3] = p_palette[word >> 24];
+      
+      p_out += 4;
+    }
+    
+    p_in = (uint8_t const *)p_word;
+  }
+  
+  for(; width; width--) *p_out++ = p_palette[*p_in++];
+}
+
+// Initializes a decoder context, nothing parsed.
+void bmpmCtxInit(struct s_bmpm_ctx *p_bmpm)
+{
+  if(!p_bmpm) return;
+  
+  memset(p_bmpm, 0, sizeof(*p_bmpm));
+}
+
+// parse a header into the context, returns the pixel offset.
+uint32_t bmpmCtxParse(struct s_bmpm_ctx *p_bmpm, void const *p_data, uint32_t len)
+{
+  if(!p_bmpm) return 0;
+  
+  if(!p_data) return 0;
+  
+  return detectBMP(p_bmpm, p_data, len);
+}
 
 //convert bitmap data to RAW, if no header detected, or incorrect header, this does nothing.
 //strip header and flip data. LEN IS NUMBER OF BYTES in OP_DATA
-uint32_t bmpmConvertToRaw(void **op_data, uint32_t len)
+uint32_t bmpmCtxConvertToRaw(struct s_bmpm_ctx *p_bmpm, void **op_data, uint32_t len)
 {
   uint32_t newLen = len;
   
-  uint8_t *p_temp = (uint8_t *)*op_data;
+  uint8_t *p_temp = NULL;
+  
+  if(!p_bmpm) return 0;
+  
+  if(!op_data || !*op_data) return 0;
+  
+  p_temp = (uint8_t *)*op_data;
   
-  detectBMP(*op_data, len);
+  // in place conversion only works for 32 bit data.
+  if(!detectBMP(p_bmpm, *op_data, len)) return 0;
   
-  if(g_bmp_data.offset <= 0) return 0;
+  if(p_bmpm->header.depth != BMP_32BIT) return 0;
   
-  newLen -= g_bmp_data.offset;
+  if(p_bmpm->header.offset > len) return 0;
+  
+  newLen -= p_bmpm->header.offset;
 
   //copy data, excluding header
-  memmove(p_temp, &p_temp[g_bmp_data.offset], newLen);
+  memmove(p_temp, &p_temp[p_bmpm->header.offset], newLen);
   
   
-  // *op_data = ((uint8_t *)*op_data)+g_bmp_data.offset;
+  // *op_data = ((uint8_t *)*op_data)+p_bmpm->header.offset;
   
 //   p_temp = realloc(*op_data, newLen);
 //   
@@ -79,86 +310,397 @@ uint32_t bmpmConvertToRaw(void **op_data, uint32_t len)
 //   
 //   *op_data = p_temp;
   
-  if(reverseData(*op_data, newLen, g_bmp_data.width, g_bmp_data.height)) return 0;
+  if(reverseData(*op_data, newLen, p_bmpm->header.width, p_bmpm->header.height)) return 0;
   
   return newLen;
   
 }
 
 //return width
-signed int bmpmGetWidth()
+signed int bmpmCtxGetWidth(struct s_bmpm_ctx *p_bmpm)
 {
-  return g_bmp_data.width;
+  if(!p_bmpm) return 0;
+  
+  return p_bmpm->header.width;
 }
 
 //return height
-signed int bmpmGetHeight()
+signed int bmpmCtxGetHeight(struct s_bmpm_ctx *p_bmpm)
 {
-  return g_bmp_data.height;
+  if(!p_bmpm) return 0;
+  
+  return p_bmpm->header.height;
 }
 
-// return header offset of the last converted bitmap
-uint32_t bmpmGetOffset()
+// return header offset of the parsed bitmap
+uint32_t bmpmCtxGetOffset(struct s_bmpm_ctx *p_bmpm)
 {
-  return g_bmp_data.offset;
+  if(!p_bmpm) return 0;
+  
+  return p_bmpm->header.offset;
 }
 
-//detects bitmap image, if it exists and is of the right type
-//this will return the offset byte location
-uint32_t detectBMP(void const *p_data, uint32_t len)
+// return bits per pixel of the parsed bitmap
+uint16_t bmpmCtxGetDepth(struct s_bmpm_ctx *p_bmpm)
 {
-  uint32_t index = 0;
+  if(!p_bmpm) return 0;
+  
+  return p_bmpm->header.depth;
+}
+
+// start streaming a bitmap into a framebuffer, header comes from the first chunk.
+uint32_t bmpmCtxStreamBegin(struct s_bmpm_ctx *p_bmpm, void const *p_data, uint32_t len, uint32_t *p_dest, uint32_t dest_stride, uint32_t dest_width, uint32_t dest_height)
+{
+  if(!p_bmpm) return 0;
+  
+  memset(&p_bmpm->stream, 0, sizeof(p_bmpm->stream));
+  
+  if(!p_dest) return 0;
+  
+  p_bmpm->stream.p_dest      = p_dest;
+  p_bmpm->stream.dest_stride = dest_stride;
+  p_bmpm->stream.dest_width  = dest_width;
+  p_bmpm->stream.dest_height = dest_height;
+  
+  return streamBegin(p_bmpm, p_data, len);
+}
+
+// start streaming a bitmap to a row callback, header comes from the first chunk.
+uint32_t bmpmCtxStreamBeginRows(struct s_bmpm_ctx *p_bmpm, void const *p_data, uint32_t len, bmpm_row_fn row_fn, void *p_ctx)
+{
+  if(!p_bmpm) return 0;
+  
+  memset(&p_bmpm->stream, 0, sizeof(p_bmpm->stream));
+  
+  if(!row_fn) return 0;
+  
+  p_bmpm->stream.row_fn      = row_fn;
+  p_bmpm->stream.p_user      = p_ctx;
+  p_bmpm->stream.dest_width  = BMPM_MAX_WIDTH;
+  p_bmpm->stream.dest_height = ~0u;
+  
+  return streamBegin(p_bmpm, p_data, len);
+}
+
+// parse the header and pick the row kernel, output is already set.
+static uint32_t streamBegin(struct s_bmpm_ctx *p_bmpm, void const *p_data, uint32_t len)
+{
+  if(!p_data) return 0;
+  
+  if(!detectBMP(p_bmpm, p_data, len)) return 0;
+  
+  if((p_bmpm->header.width <= 0) || (p_bmpm->header.width > BMPM_MAX_WIDTH) || (p_bmpm->header.height == 0)) return 0;
+  
+  // a negative height is a top down bitmap, no flip. rle is always bottom up.
+  p_bmpm->stream.top_down = (p_bmpm->header.height < 0);
+  
+  if(p_bmpm->stream.top_down && (p_bmpm->header.compression == BMP_RLE8)) return 0;
   
-  uint8_t *p_temp = (uint8_t *)p_data;
-  //not enough data to be a bitmap, must be larger than the header
-  if(len < HEADER_SIZE) return 0;
+  p_bmpm->stream.rows = (uint32_t)(p_bmpm->stream.top_down ? -p_bmpm->header.height : p_bmpm->header.height);
   
-  g_bmp_data.width = 0;
-  g_bmp_data.height = 0;
-  g_bmp_data.depth = 0;
-  g_bmp_data.offset = 0;
+  // rows are padded to a whole word.
+  p_bmpm->stream.row_bytes = (((uint32_t)p_bmpm->header.width * p_bmpm->header.depth + 31) / 32) * 4;
   
-  for(index = 0; index < HEADER_SIZE; index++)
+  switch(p_bmpm->header.depth)
   {
-    switch(index)
+    case BMP_8BIT:
+      p_bmpm->stream.convert = convertRow8;
+      break;
+    case BMP_16BIT:
+      p_bmpm->stream.convert = (p_bmpm->header.green_mask == BMP_565_GREEN ? convertRow565 : convertRow555);
+      break;
+    case BMP_24BIT:
+      p_bmpm->stream.convert = convertRow24;
+      break;
+    default:
+      p_bmpm->stream.convert = convertRow32;
+      break;
+  }
+  
+  if(p_bmpm->stream.dest_width > (uint32_t)p_bmpm->header.width) p_bmpm->stream.dest_width = (uint32_t)p_bmpm->header.width;
+  
+  // the palette follows the info header, it is picked out of the bytes skipped up to the pixels.
+  if(p_bmpm->header.depth == BMP_8BIT)
+  {
+    p_bmpm->stream.palette_start = 14 + p_bmpm->header.dib_size;
+    p_bmpm->stream.palette_end   = p_bmpm->stream.palette_start + (p_bmpm->header.colors ? p_bmpm->header.colors : 256) * sizeof(uint32_t);
+  }
+  
+  p_bmpm->stream.rle = (p_bmpm->header.compression == BMP_RLE8);
+  
+  // header is skipped like any other bytes before the pixels.
+  p_bmpm->stream.skip = p_bmpm->header.offset;
+  
+  bmpmCtxStreamData(p_bmpm, p_data, len);
+  
+  return p_bmpm->header.offset;
+}
+
+// convert one file row and send it to the destination or callback.
+static void emitRow(struct s_bmpm_ctx *p_bmpm, uint8_t const *p_row)
+{
+  uint32_t dest_row = (p_bmpm->stream.top_down ? p_bmpm->stream.row : p_bmpm->stream.rows - 1 - p_bmpm->stream.row);
+  
+  if(p_bmpm->stream.row_fn)
+  {
+    p_bmpm->stream.convert(p_bmpm->stream.out, p_row, p_bmpm->stream.dest_width, p_bmpm->stream.palette);
+    
+    p_bmpm->stream.row_fn(dest_row, p_bmpm->stream.out, p_bmpm->stream.dest_width, p_bmpm->stream.p_user);
+  }
+  else if(dest_row < p_bmpm->stream.dest_height)
+  {
+    // straight into the flipped row, no intermediate copy.
+    p_bmpm->stream.convert(p_bmpm->stream.p_dest + dest_row * p_bmpm->stream.dest_stride, p_row, p_bmpm->stream.dest_width, p_bmpm->stream.palette);
+  }
+  
+  p_bmpm->stream.row++;
+}
+
+// emit the rle index row and start a blank one.
+static void emitRleRow(struct s_bmpm_ctx *p_bmpm)
+{
+  emitRow(p_bmpm, p_bmpm->stream.stage);
+  
+  memset(p_bmpm->stream.stage, 0, (uint32_t)p_bmpm->header.width);
+  
+  p_bmpm->stream.rle_x = 0;
+}
+
+// put one rle8 palette index in the row being built.
+static inline void putRle(struct s_bmpm_ctx *p_bmpm, uint8_t index)
+{
+  if(p_bmpm->stream.rle_x < (uint32_t)p_bmpm->header.width) p_bmpm->stream.stage[p_bmpm->stream.rle_x] = index;
+  
+  p_bmpm->stream.rle_x++;
+}
+
+// run the rle8 decoder over a chunk, runs decode into an index row that the 8 bit kernel converts.
+static void decodeRle(struct s_bmpm_ctx *p_bmpm, uint8_t const *p_data, uint32_t len)
+{
+  for(; len && (p_bmpm->stream.row < p_bmpm->stream.rows); len--)
+  {
+    uint8_t data = *p_data++;
+    
+    switch(p_bmpm->stream.rle_state)
     {
-      case 0:
-        if(p_temp[index] != 'B') return 0;
+      case RLE_COUNT:
+        p_bmpm->stream.rle_count = data;
+        p_bmpm->stream.rle_state = (data ? RLE_RUN : RLE_ESCAPE);
         break;
-      case 1:
-        if(p_temp[index] != 'M') return 0;
-        break;
-      case 10:
-      case 11:
-      case 12:
-      case 13:
-        g_bmp_data.offset |= (uint32_t)(p_temp[index] << ((index - 10) * 8));
+      case RLE_RUN:
+        for(; p_bmpm->stream.rle_count; p_bmpm->stream.rle_count--) putRle(p_bmpm, data);
+        
+        p_bmpm->stream.rle_state = RLE_COUNT;
         break;
-      case 18:
-      case 19:
-      case 20:
-      case 21:
-        g_bmp_data.width |= p_temp[index] << ((index - 18) * 8);
+      case RLE_ESCAPE:
+        switch(data)
+        {
+          // end of line
+          case 0:
+            emitRleRow(p_bmpm);
+            p_bmpm->stream.rle_state = RLE_COUNT;
+            break;
+          // end of bitmap, rows not reached are left as they were.
+          case 1:
+            emitRleRow(p_bmpm);
+            p_bmpm->stream.row = p_bmpm->stream.rows;
+            p_bmpm->stream.rle_state = RLE_END;
+            break;
+          case 2:
+            p_bmpm->stream.rle_state = RLE_DELTA_X;
+            break;
+          // absolute run of data indexes, padded to a word (16 bit) boundary.
+          default:
+            p_bmpm->stream.rle_count = data;
+            p_bmpm->stream.rle_pad   = data & 1;
+            p_bmpm->stream.rle_state = RLE_ABSOLUTE;
+            break;
+        }
         break;
-      case 22:
-      case 23:
-      case 24:
-      case 25:
-        g_bmp_data.height |= p_temp[index] << ((index - 22) * 8);
+      case RLE_DELTA_X:
+        p_bmpm->stream.rle_x += data;
+        p_bmpm->stream.rle_state = RLE_DELTA_Y;
         break;
-      case 28:
-        g_bmp_data.depth = (uint16_t)p_temp[index];
+      case RLE_DELTA_Y:
+        // the x offset carries over into the row the delta lands on.
+        for(; data && (p_bmpm->stream.row < p_bmpm->stream.rows); data--)
+        {
+          uint32_t x = p_bmpm->stream.rle_x;
+          
+          emitRleRow(p_bmpm);
+          
+          p_bmpm->stream.rle_x = x;
+        }
+        
+        p_bmpm->stream.rle_state = RLE_COUNT;
         break;
-      case 29:
-        g_bmp_data.depth |= ((uint16_t)p_temp[index]) << 8;
+      case RLE_ABSOLUTE:
+        putRle(p_bmpm, data);
         
-        if(g_bmp_data.depth != BMP_32BIT) return 0;
+        if(!--p_bmpm->stream.rle_count) p_bmpm->stream.rle_state = (p_bmpm->stream.rle_pad ? RLE_PAD : RLE_COUNT);
+        break;
+      case RLE_PAD:
+        p_bmpm->stream.rle_state = RLE_COUNT;
+        break;
       default:
         break;
     }
   }
+}
+
+// write the next chunk of the file straight to the destination rows.
+uint32_t bmpmCtxStreamData(struct s_bmpm_ctx *p_bmpm, void const *p_data, uint32_t len)
+{
+  uint32_t count = 0;
+  
+  uint8_t const *p_temp = (uint8_t const *)p_data;
+  
+  if(!p_bmpm) return 0;
+  
+  if(!p_bmpm->stream.convert) return 0;
+  
+  if(!p_data) return p_bmpm->stream.rows - p_bmpm->stream.row;
+  
+  while(len && (p_bmpm->stream.row < p_bmpm->stream.rows))
+  {
+    if(p_bmpm->stream.skip)
+    {
+      count = (p_bmpm->stream.skip < len ? p_bmpm->stream.skip : len);
+      
+      // keep any palette bytes that go by.
+      for(uint32_t index = 0; index < count; index++)
+      {
+        uint32_t file_pos = p_bmpm->stream.file_pos + index;
+        
+        if((file_pos >= p_bmpm->stream.palette_start) && (file_pos < p_bmpm->stream.palette_end))
+        {
+          ((uint8_t *)p_bmpm->stream.palette)[file_pos - p_bmpm->stream.palette_start] = p_temp[index];
+        }
+      }
+      
+      p_bmpm->stream.skip     -= count;
+      p_bmpm->stream.file_pos += count;
+    }
+    else if(p_bmpm->stream.rle)
+    {
+      decodeRle(p_bmpm, p_temp, len);
+      
+      count = len;
+    }
+    else if(!p_bmpm->stream.pos && (len >= p_bmpm->stream.row_bytes))
+    {
+      // whole row in the chunk, convert it where it is.
+      count = p_bmpm->stream.row_bytes;
+      
+      emitRow(p_bmpm, p_temp);
+    }
+    else
+    {
+      // partial row, gather it first.
+      count = p_bmpm->stream.row_bytes - p_bmpm->stream.pos;
+      
+      if(count > len) count = len;
+      
+      memcpy(&p_bmpm->stream.stage[p_bmpm->stream.pos], p_temp, count);
+      
+      p_bmpm->stream.pos += count;
+      
+      if(p_bmpm->stream.pos >= p_bmpm->stream.row_bytes)
+      {
+        p_bmpm->stream.pos = 0;
+        
+        emitRow(p_bmpm, p_bmpm->stream.stage);
+      }
+    }
+    
+    p_temp += count;
+    len    -= count;
+  }
+  
+  return p_bmpm->stream.rows - p_bmpm->stream.row;
+}
+
+// bytes in one row of the bitmap being streamed
+uint32_t bmpmCtxStreamRowBytes(struct s_bmpm_ctx *p_bmpm)
+{
+  if(!p_bmpm) return 0;
+  
+  return p_bmpm->stream.row_bytes;
+}
+
+// bytes to read next so later reads start on a row
+uint32_t bmpmCtxStreamChunkBytes(struct s_bmpm_ctx *p_bmpm)
+{
+  if(!p_bmpm) return 0;
+  
+  if(p_bmpm->stream.skip) return p_bmpm->stream.skip;
+  
+  if(p_bmpm->stream.rle) return p_bmpm->stream.row_bytes;
+  
+  return p_bmpm->stream.row_bytes - p_bmpm->stream.pos;
+}
+
+//detects bitmap image, if it exists and is of the right type
+//this will return the offset byte location
+uint32_t detectBMP(struct s_bmpm_ctx *p_bmpm, void const *p_data, uint32_t len)
+{
+  uint8_t const *p_temp = (uint8_t const *)p_data;
+  
+  memset(&p_bmpm->header, 0, sizeof(p_bmpm->header));
+  
+  //not enough data to be a bitmap, must be larger than the info header
+  if(len < BMP_INFO_SIZE) return 0;
+  
+  if((p_temp[0] != 'B') || (p_temp[1] != 'M')) return 0;
+  
+  p_bmpm->header.offset      = readLE(&p_temp[10], 4);
+  p_bmpm->header.dib_size    = readLE(&p_temp[14], 4);
+  p_bmpm->header.width       = (signed int)readLE(&p_temp[18], 4);
+  p_bmpm->header.height      = (signed int)readLE(&p_temp[22], 4);
+  p_bmpm->header.depth       = (uint16_t)readLE(&p_temp[28], 2);
+  p_bmpm->header.compression = readLE(&p_temp[30], 4);
+  p_bmpm->header.colors      = readLE(&p_temp[46], 4);
+  
+  if(p_bmpm->header.colors > 256) return 0;
+  
+  switch(p_bmpm->header.depth)
+  {
+    case BMP_8BIT:
+      if((p_bmpm->header.compression != BMP_RGB) && (p_bmpm->header.compression != BMP_RLE8)) return 0;
+      break;
+    case BMP_16BIT:
+      p_bmpm->header.green_mask = BMP_555_GREEN;
+      
+      if(p_bmpm->header.compression == BMP_BITFIELDS)
+      {
+        //masks follow the 40 byte info header, or are part of a v4/v5 header.
+        if(len < BMP_INFO_SIZE + 12) return 0;
+        
+        p_bmpm->header.green_mask = readLE(&p_temp[BMP_INFO_SIZE + 4], 4);
+        
+        if((p_bmpm->header.green_mask != BMP_565_GREEN) && (p_bmpm->header.green_mask != BMP_555_GREEN)) return 0;
+      }
+      else if(p_bmpm->header.compression != BMP_RGB) return 0;
+      break;
+    case BMP_24BIT:
+      if(p_bmpm->header.compression != BMP_RGB) return 0;
+      break;
+    case BMP_32BIT:
+      if(p_bmpm->header.compression == BMP_BITFIELDS)
+      {
+        if(len < BMP_INFO_SIZE + 12) return 0;
+        
+        if(readLE(&p_temp[BMP_INFO_SIZE], 4) != 0x00FF0000) return 0;
+        if(readLE(&p_temp[BMP_INFO_SIZE + 4], 4) != 0x0000FF00) return 0;
+        if(readLE(&p_temp[BMP_INFO_SIZE + 8], 4) != 0x000000FF) return 0;
+      }
+      else if(p_bmpm->header.compression != BMP_RGB) return 0;
+      break;
+    default:
+      return 0;
+  }
   
-  return g_bmp_data.offset;
+  return p_bmpm->header.offset;
 }
 
 //reverse data, swap bottom to top and top to bottom.
@@ -1,7 +1,7 @@
 /***************************************************************************//**
   * @file     bmpm.h
   * @brief    bitmap to raw conversion
-  * @details  Convert 32bit XA8R8G8B images to RAW 32bit images, flips lines.
+  * @details  Convert 32, 24, 16 and 8 bit (RLE8) bitmaps to RAW 32bit XA8R8G8B images, flips lines.
   * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
   * @date     01/13/2026
   * @version
@@ -35,9 +35,26 @@
 #define __UTIL_BMPMANIP_H
 
 #define HEADER_SIZE     138
+#define BMP_INFO_SIZE   54
+#define BMP_8BIT        0x08
 #define BMP_16BIT       0x10
+#define BMP_24BIT       0x18
 #define BMP_32BIT       0x20
 #define BMP_COLOR_MASK  0x1F
+#define BMP_RGB         0
+#define BMP_RLE8        1
+#define BMP_BITFIELDS   3
+#define BMP_565_GREEN   0x07E0
+#define BMP_555_GREEN   0x03E0
+
+#ifndef BMPM_MAX_WIDTH
+#define BMPM_MAX_WIDTH  1024
+#endif
+
+// 0 drops the calls without a context and the ~9KB context they share.
+#ifndef BMPM_SHARED_CTX
+#define BMPM_SHARED_CTX 1
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -45,8 +62,150 @@ extern "C" {
 
 #include <stdint.h>
 
+/**
+ * @typedef bmpm_row_fn
+ * @brief gets each converted a8r8g8b8 row from bmpmStreamBeginRows,
+ * row counts down from the top of the image. p_pixels is only valid
+ * during the call.
+ */
+typedef void (*bmpm_row_fn)(uint32_t row, uint32_t const *p_pixels, uint32_t width, void *p_ctx);
+
+/**
+ * @typedef bmpm_convert
+ * @brief row conversion kernel, width pixels from p_in to a8r8g8b8.
+ */
+typedef void (*bmpm_convert)(uint32_t *p_out, uint8_t const *p_in, uint32_t width, uint32_t const *p_palette);
+
+/**
+ * @struct s_bmpm_ctx
+ * @brief decoder state for one image, so several can be parsed and
+ * streamed at once. Treat as opaque, about 9KB with the row buffers.
+ */
+struct s_bmpm_ctx
+{
+  /**
+   * @struct s_bmpm_header
+   * @brief fields from the parsed header.
+   */
+  struct
+  {
+    signed int width;
+    signed int height;
+    uint16_t depth;
+    uint32_t offset;
+    uint32_t dib_size;
+    uint32_t compression;
+    uint32_t colors;
+    uint32_t green_mask;
+  } header;
+
+  /**
+   * @struct s_bmpm_stream
+   * @brief state of the bitmap being streamed, rows are in file
+   * (bottom up) order.
+   */
+  struct
+  {
+    uint32_t *p_dest;
+    uint32_t dest_stride;
+    uint32_t dest_width;
+    uint32_t dest_height;
+    bmpm_row_fn row_fn;
+    void *p_user;
+    bmpm_convert convert;
+    uint32_t row_bytes;
+    uint32_t rows;
+    uint32_t row;
+    uint32_t pos;
+    uint32_t skip;
+    uint32_t file_pos;
+    uint32_t palette_start;
+    uint32_t palette_end;
+    uint8_t top_down;
+    uint8_t rle;
+    uint8_t rle_state;
+    uint8_t rle_count;
+    uint8_t rle_pad;
+    uint32_t rle_x;
+    uint32_t palette[256];
+    uint8_t stage[BMPM_MAX_WIDTH * sizeof(uint32_t)];
+    uint32_t out[BMPM_MAX_WIDTH];
+  } stream;
+};
+
+/*********************************************//**
+  * @brief Initializes a decoder context, nothing parsed.
+  *
+  * @param p_bmpm context to init.
+  *************************************************/
+void bmpmCtxInit(struct s_bmpm_ctx *p_bmpm);
+
+/*********************************************//**
+  * @brief Parse a bitmap header into a context.
+  *
+  * @param p_bmpm context from bmpmCtxInit.
+  * @param p_data start of the file.
+  * @param len Total number of bytes in p_data.
+  * 
+  * @return 0 on error or unsupported, header offset on success.
+  *************************************************/
+uint32_t bmpmCtxParse(struct s_bmpm_ctx *p_bmpm, void const *p_data, uint32_t len);
+
+/*********************************************//**
+  * @brief bmpmConvertToRaw on a context.
+  *************************************************/
+uint32_t bmpmCtxConvertToRaw(struct s_bmpm_ctx *p_bmpm, void **op_data, uint32_t len);
+
+/*********************************************//**
+  * @brief bmpmGetWidth on a context.
+  *************************************************/
+signed int bmpmCtxGetWidth(struct s_bmpm_ctx *p_bmpm);
+
+/*********************************************//**
+  * @brief bmpmGetHeight on a context.
+  *************************************************/
+signed int bmpmCtxGetHeight(struct s_bmpm_ctx *p_bmpm);
+
+/*********************************************//**
+  * @brief bmpmGetOffset on a context.
+  *************************************************/
+uint32_t bmpmCtxGetOffset(struct s_bmpm_ctx *p_bmpm);
+
+/*********************************************//**
+  * @brief bmpmGetDepth on a context.
+  *************************************************/
+uint16_t bmpmCtxGetDepth(struct s_bmpm_ctx *p_bmpm);
+
+/*********************************************//**
+  * @brief bmpmStreamBegin on a context.
+  *************************************************/
+uint32_t bmpmCtxStreamBegin(struct s_bmpm_ctx *p_bmpm, void const *p_data, uint32_t len, uint32_t *p_dest, uint32_t dest_stride, uint32_t dest_width, uint32_t dest_height);
+
+/*********************************************//**
+  * @brief bmpmStreamBeginRows on a context.
+  *************************************************/
+uint32_t bmpmCtxStreamBeginRows(struct s_bmpm_ctx *p_bmpm, void const *p_data, uint32_t len, bmpm_row_fn row_fn, void *p_ctx);
+
 /*********************************************//**
-  * @brief Convert bitmap image to raw pixels
+  * @brief bmpmStreamData on a context.
+  *************************************************/
+uint32_t bmpmCtxStreamData(struct s_bmpm_ctx *p_bmpm, void const *p_data, uint32_t len);
+
+/*********************************************//**
+  * @brief bmpmStreamRowBytes on a context.
+  *************************************************/
+uint32_t bmpmCtxStreamRowBytes(struct s_bmpm_ctx *p_bmpm);
+
+/*********************************************//**
+  * @brief bmpmStreamChunkBytes on a context.
+  *************************************************/
+uint32_t bmpmCtxStreamChunkBytes(struct s_bmpm_ctx *p_bmpm);
+
+#if BMPM_SHARED_CTX
+/*********************************************//**
+  * @brief Convert bitmap image to raw pixels. This and
+  * the other calls without a context share one, use
+  * the bmpmCtx calls to decode more than one at a time.
   *
   * @param op_data Double pointer to memory that contains image data.
   * @param len Total number of bytes in buffer.
@@ -76,6 +235,83 @@ signed int bmpmGetHeight();
   *************************************************/
 uint32_t bmpmGetOffset();
 
+/*********************************************//**
+  * @brief Get the bits per pixel of the last converted bitmap
+  *
+  * @return 0 on error, depth on success.
+  *************************************************/
+uint16_t bmpmGetDepth();
+
+/*********************************************//**
+  * @brief Start streaming a bitmap into a framebuffer,
+  * no full image buffer is needed. Parses the header
+  * from the first chunk (at least HEADER_SIZE bytes),
+  * any pixel data after the header offset in the chunk
+  * is written out as with bmpmStreamData.
+  *
+  * 32 bit, 24 bit, 16 bit (565 or 555) and 8 bit
+  * palettised (plain or RLE8) bitmaps are converted to
+  * a8r8g8b8. Rows land directly in their flipped
+  * destination row, the image is clipped to dest_width
+  * by dest_height.
+  *
+  * @param p_data first chunk of the file.
+  * @param len Total number of bytes in p_data.
+  * @param p_dest top left pixel of the destination.
+  * @param dest_stride pixels from one destination row to the next.
+  * @param dest_width destination columns.
+  * @param dest_height destination rows.
+  * 
+  * @return 0 on error, header offset on success.
+  *************************************************/
+uint32_t bmpmStreamBegin(void const *p_data, uint32_t len, uint32_t *p_dest, uint32_t dest_stride, uint32_t dest_width, uint32_t dest_height);
+
+/*********************************************//**
+  * @brief Start streaming a bitmap to a row callback,
+  * same as bmpmStreamBegin but each converted row goes
+  * to row_fn instead of a framebuffer.
+  *
+  * @param p_data first chunk of the file.
+  * @param len Total number of bytes in p_data.
+  * @param row_fn called once per row, in file order.
+  * @param p_ctx passed to row_fn.
+  * 
+  * @return 0 on error, header offset on success.
+  *************************************************/
+uint32_t bmpmStreamBeginRows(void const *p_data, uint32_t len, bmpm_row_fn row_fn, void *p_ctx);
+
+/*********************************************//**
+  * @brief Write the next chunk of the file, following
+  * the one given to bmpmStreamBegin. Chunks can split
+  * anywhere, one row (bmpmStreamRowBytes) per chunk
+  * copies each row to vram in one go.
+  *
+  * @param p_data next chunk of the file.
+  * @param len Total number of bytes in p_data.
+  * 
+  * @return rows still to come, 0 when the image is done.
+  *************************************************/
+uint32_t bmpmStreamData(void const *p_data, uint32_t len);
+
+/*********************************************//**
+  * @brief Get the bytes in one row of the bitmap being
+  * streamed, the best chunk size for bmpmStreamData.
+  *
+  * @return 0 if not streaming, row bytes on success.
+  *************************************************/
+uint32_t bmpmStreamRowBytes();
+
+/*********************************************//**
+  * @brief Get how many bytes to read next, reading that
+  * much keeps every later row sized chunk on a row (and
+  * word) boundary so rows convert in place. Covers the
+  * rest of the header/palette first.
+  *
+  * @return 0 if not streaming, bytes on success.
+  *************************************************/
+uint32_t bmpmStreamChunkBytes();
+#endif
+
 #ifdef __cplusplus
 }
 #endif
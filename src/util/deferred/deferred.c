@@ -0,0 +1,183 @@
+/***************************************************************************//**
+  * @file     deferred.c
+  * @brief    Deferred work queue
+  * @details  Lock free queue of work posted by interrupt handlers and run later from the machine software interrupt or idle loop.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "deferred.h"
+
+#define DEFERRED_QUEUE_MASK (DEFERRED_QUEUE_SIZE - 1)
+
+/**
+ * @struct s_deferred_item
+ * @brief queue slot, seq says whose turn it is (Vyukov bounded queue).
+ */
+struct s_deferred_item
+{
+  volatile uint32_t seq;
+  deferred_fn fn;
+  void *p_ctx;
+};
+
+static struct
+{
+  struct s_clint *p_clint;
+  volatile uint32_t enqueue;
+  volatile uint32_t dequeue;
+  volatile uint32_t dropped;
+  struct s_deferred_item items[DEFERRED_QUEUE_SIZE];
+} g_deferred;
+
+// Initializes the deferred work queue
+void initDeferred(struct s_clint *p_clint)
+{
+  uint32_t index;
+
+  memset(&g_deferred, 0, sizeof(g_deferred));
+
+  g_deferred.p_clint = p_clint;
+
+  for(index = 0; index < DEFERRED_QUEUE_SIZE; index++)
+  {
+    g_deferred.items[index].seq = index;
+  }
+}
+
+// queue work and raise msip
+int postDeferred(deferred_fn fn, void *p_ctx)
+{
+  uint32_t pos;
+  uint32_t seq;
+  int32_t diff;
+
+  struct s_deferred_item *p_item = NULL;
+
+  if(!fn) return 1;
+
+  pos = __atomic_load_n(&g_deferred.enqueue, __ATOMIC_RELAXED);
+
+  for(;;)
+  {
+    p_item = &g_deferred.items[pos & DEFERRED_QUEUE_MASK];
+
+    seq  = __atomic_load_n(&p_item->seq, __ATOMIC_ACQUIRE);
+    diff = (int32_t)(seq - pos);
+
+    if(diff == 0)
+    {
+      // slot is free for this position, claim it. A nested handler may race us here.
+      if(__atomic_compare_exchange_n(&g_deferred.enqueue, &pos, pos + 1, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+    }
+    else if(diff < 0)
+    {
+      __atomic_fetch_add(&g_deferred.dropped, 1, __ATOMIC_RELAXED);
+
+      return 1;
+    }
+    else
+    {
+      pos = __atomic_load_n(&g_deferred.enqueue, __ATOMIC_RELAXED);
+    }
+  }
+
+  p_item->fn    = fn;
+  p_item->p_ctx = p_ctx;
+
+  __atomic_store_n(&p_item->seq, pos + 1, __ATOMIC_RELEASE);
+
+  if(g_deferred.p_clint) setClintMsip(g_deferred.p_clint);
+
+  return 0;
+}
+
+// run queued work until the queue is empty
+uint32_t runDeferred(void)
+{
+  uint32_t count = 0;
+  uint32_t pos;
+  uint32_t seq;
+  int32_t diff;
+
+  deferred_fn fn;
+  void *p_ctx;
+
+  struct s_deferred_item *p_item = NULL;
+
+  // clear first, a post while draining raises it again.
+  if(g_deferred.p_clint) clrClintMsip(g_deferred.p_clint);
+
+  pos = __atomic_load_n(&g_deferred.dequeue, __ATOMIC_RELAXED);
+
+  for(;;)
+  {
+    p_item = &g_deferred.items[pos & DEFERRED_QUEUE_MASK];
+
+    seq  = __atomic_load_n(&p_item->seq, __ATOMIC_ACQUIRE);
+    diff = (int32_t)(seq - (pos + 1));
+
+    if(diff == 0)
+    {
+      // the idle loop and the msi handler can both be draining.
+      if(!__atomic_compare_exchange_n(&g_deferred.dequeue, &pos, pos + 1, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) continue;
+
+      fn    = p_item->fn;
+      p_ctx = p_item->p_ctx;
+
+      // hand the slot back to the producers before running the work.
+      __atomic_store_n(&p_item->seq, pos + DEFERRED_QUEUE_SIZE, __ATOMIC_RELEASE);
+
+      fn(p_ctx);
+
+      count++;
+
+      pos = __atomic_load_n(&g_deferred.dequeue, __ATOMIC_RELAXED);
+    }
+    else if(diff < 0)
+    {
+      // empty
+      break;
+    }
+    else
+    {
+      pos = __atomic_load_n(&g_deferred.dequeue, __ATOMIC_RELAXED);
+    }
+  }
+
+  return count;
+}
+
+// get the number of posts lost to a full queue
+uint32_t getDeferredDropped(void)
+{
+  return g_deferred.dropped;
+}
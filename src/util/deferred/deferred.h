@@ -0,0 +1,99 @@
+/***************************************************************************//**
+  * @file     deferred.h
+  * @brief    Deferred work queue
+  * @details  Lock free queue of work posted by interrupt handlers and run later from the machine software interrupt or idle loop.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __DEFERRED_H
+#define __DEFERRED_H
+
+#include <stdint.h>
+
+#include <clint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def DEFERRED_QUEUE_SIZE
+ * number of queued work items, must be a power of 2.
+ */
+#ifndef DEFERRED_QUEUE_SIZE
+#define DEFERRED_QUEUE_SIZE 32
+#endif
+
+/**
+ * @typedef deferred_fn
+ * @brief deferred work function
+ */
+typedef void (*deferred_fn)(void *p_ctx);
+
+/*********************************************//**
+  * @brief Initializes the deferred work queue, empty.
+  *
+  * @param p_clint pre-initialized struct from initClint,
+  * msip is raised on every post. NULL to only drain from
+  * an idle loop.
+  *************************************************/
+void initDeferred(struct s_clint *p_clint);
+
+/*********************************************//**
+  * @brief queue work and raise msip, safe from any
+  * interrupt handler including nested ones.
+  *
+  * @param fn function to run later
+  * @param p_ctx passed to fn
+  *
+  * @return 0 on success, 1 if the queue is full (counted as dropped).
+  *************************************************/
+int postDeferred(deferred_fn fn, void *p_ctx);
+
+/*********************************************//**
+  * @brief run queued work until the queue is empty.
+  * Call from riscv_mtvec_msi (ideally a NESTED_IRQ_HANDLER
+  * so hard interrupts still preempt it) or an idle loop.
+  *
+  * @return number of items run.
+  *************************************************/
+uint32_t runDeferred(void);
+
+/*********************************************//**
+  * @brief get the number of posts lost to a full queue.
+  *
+  * @return dropped count
+  *************************************************/
+uint32_t getDeferredDropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,358 @@
+/***************************************************************************//**
+  * @file     fbcon.c
+  * @brief    AXI TFT text console
+  * @details  8x8 font console rendered through a colour-resolved row cache into a scroll ring.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <string.h>
+
+#include "fbcon.h"
+
+// printable ascii, space to ~, bit 0 of each row byte is the leftmost pixel (public domain font8x8_basic).
+static const uint8_t g_fbcon_font['~' - ' ' + 1][FBCON_GLYPH_HEIGHT] =
+{
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // space
+  {0x18, 0x3C, 0x3C, 0x18, 0x18, 0x00, 0x18, 0x00}, // !
+  {0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // "
+  {0x36, 0x36, 0x7F, 0x36, 0x7F, 0x36, 0x36, 0x00}, // #
+  {0x0C, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x0C, 0x00}, // $
+  {0x00, 0x63, 0x33, 0x18, 0x0C, 0x66, 0x63, 0x00}, // %
+  {0x1C, 0x36, 0x1C, 0x6E, 0x3B, 0x33, 0x6E, 0x00}, // &
+  {0x06, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}, // '
+  {0x18, 0x0C, 0x06, 0x06, 0x06, 0x0C, 0x18, 0x00}, // (
+  {0x06, 0x0C, 0x18, 0x18, 0x18, 0x0C, 0x06, 0x00}, // )
+  {0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00}, // *
+  {0x00, 0x0C, 0x0C, 0x3F, 0x0C, 0x0C, 0x00, 0x00}, // +
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x06}, // ,
+  {0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00}, // -
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00}, // .
+  {0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00}, // /
+  {0x3E, 0x63, 0x73, 0x7B, 0x6F, 0x67, 0x3E, 0x00}, // 0
+  {0x0C, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x00}, // 1
+  {0x1E, 0x33, 0x30, 0x1C, 0x06, 0x33, 0x3F, 0x00}, // 2
+  {0x1E, 0x33, 0x30, 0x1C, 0x30, 0x33, 0x1E, 0x00}, // 3
+  {0x38, 0x3C, 0x36, 0x33, 0x7F, 0x30, 0x78, 0x00}, // 4
+  {0x3F, 0x03, 0x1F, 0x30, 0x30, 0x33, 0x1E, 0x00}, // 5
+  {0x1C, 0x06, 0x03, 0x1F, 0x33, 0x33, 0x1E, 0x00}, // 6
+  {0x3F, 0x33, 0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x00}, // 7
+  {0x1E, 0x33, 0x33, 0x1E, 0x33, 0x33, 0x1E, 0x00}, // 8
+  {0x1E, 0x33, 0x33, 0x3E, 0x30, 0x18, 0x0E, 0x00}, // 9
+  {0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x00}, // :
+  {0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x06}, // ;
+  {0x18, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x18, 0x00}, // <
+  {0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00}, // =
+  {0x06, 0x0C, 0x18, 0x30, 0x18, 0x0C, 0x06, 0x00}, // >
+  {0x1E, 0x33, 0x30, 0x18, 0x0C, 0x00, 0x0C, 0x00}, // ?
+  {0x3E, 0x63, 0x7B, 0x7B, 0x7B, 0x03, 0x1E, 0x00}, // @
+  {0x0C, 0x1E, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x00}, // A
+  {0x3F, 0x66, 0x66, 0x3E, 0x66, 0x66, 0x3F, 0x00}, // B
+  {0x3C, 0x66, 0x03, 0x03, 0x03, 0x66, 0x3C, 0x00}, // C
+  {0x1F, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1F, 0x00}, // D
+  {0x7F, 0x46, 0x16, 0x1E, 0x16, 0x46, 0x7F, 0x00}, // E
+  {0x7F, 0x46, 0x16, 0x1E, 0x16, 0x06, 0x0F, 0x00}, // F
+  {0x3C, 0x66, 0x03, 0x03, 0x73, 0x66, 0x7C, 0x00}, // G
+  {0x33, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x33, 0x00}, // H
+  {0x1E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00}, // I
+  {0x78, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E, 0x00}, // J
+  {0x67, 0x66, 0x36, 0x1E, 0x36, 0x66, 0x67, 0x00}, // K
+  {0x0F, 0x06, 0x06, 0x06, 0x46, 0x66, 0x7F, 0x00}, // L
+  {0x63, 0x77, 0x7F, 0x7F, 0x6B, 0x63, 0x63, 0x00}, // M
+  {0x63, 0x67, 0x6F, 0x7B, 0x73, 0x63, 0x63, 0x00}, // N
+  {0x1C, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1C, 0x00}, // O
+  {0x3F, 0x66, 0x66, 0x3E, 0x06, 0x06, 0x0F, 0x00}, // P
+  {0x1E, 0x33, 0x33, 0x33, 0x3B, 0x1E, 0x38, 0x00}, // Q
+  {0x3F, 0x66, 0x66, 0x3E, 0x36, 0x66, 0x67, 0x00}, // R
+  {0x1E, 0x33, 0x07, 0x0E, 0x38, 0x33, 0x1E, 0x00}, // S
+  {0x3F, 0x2D, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00}, // T
+  {0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x00}, // U
+  {0x33, 0x33, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00}, // V
+  {0x63, 0x63, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00}, // W
+  {0x63, 0x63, 0x36, 0x1C, 0x1C, 0x36, 0x63, 0x00}, // X
+  {0x33, 0x33, 0x33, 0x1E, 0x0C, 0x0C, 0x1E, 0x00}, // Y
+  {0x7F, 0x63, 0x31, 0x18, 0x4C, 0x66, 0x7F, 0x00}, // Z
+  {0x1E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1E, 0x00}, // [
+  {0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x00}, // backslash
+  {0x1E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1E, 0x00}, // ]
+  {0x08, 0x1C, 0x36, 0x63, 0x00, 0x00, 0x00, 0x00}, // ^
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF}, // _
+  {0x0C, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00}, // `
+  {0x00, 0x00, 0x1E, 0x30, 0x3E, 0x33, 0x6E, 0x00}, // a
+  {0x07, 0x06, 0x06, 0x3E, 0x66, 0x66, 0x3B, 0x00}, // b
+  {0x00, 0x00, 0x1E, 0x33, 0x03, 0x33, 0x1E, 0x00}, // c
+  {0x38, 0x30, 0x30, 0x3E, 0x33, 0x33, 0x6E, 0x00}, // d
+  {0x00, 0x00, 0x1E, 0x33, 0x3F, 0x03, 0x1E, 0x00}, // e
+  {0x1C, 0x36, 0x06, 0x0F, 0x06, 0x06, 0x0F, 0x00}, // f
+  {0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x1F}, // g
+  {0x07, 0x06, 0x36, 0x6E, 0x66, 0x66, 0x67, 0x00}, // h
+  {0x0C, 0x00, 0x0E, 0x0C, 0x0C, 0x0C, 0x1E, 0x00}, // i
+  {0x30, 0x00, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E}, // j
+  {0x07, 0x06, 0x66, 0x36, 0x1E, 0x36, 0x67, 0x00}, // k
+  {0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00}, // l
+  {0x00, 0x00, 0x33, 0x7F, 0x7F, 0x6B, 0x63, 0x00}, // m
+  {0x00, 0x00, 0x1F, 0x33, 0x33, 0x33, 0x33, 0x00}, // n
+  {0x00, 0x00, 0x1E, 0x33, 0x33, 0x33, 0x1E, 0x00}, // o
+  {0x00, 0x00, 0x3B, 0x66, 0x66, 0x3E, 0x06, 0x0F}, // p
+  {0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x78}, // q
+  {0x00, 0x00, 0x3B, 0x6E, 0x66, 0x06, 0x0F, 0x00}, // r
+  {0x00, 0x00, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x00}, // s
+  {0x08, 0x0C, 0x3E, 0x0C, 0x0C, 0x2C, 0x18, 0x00}, // t
+  {0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x6E, 0x00}, // u
+  {0x00, 0x00, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00}, // v
+  {0x00, 0x00, 0x63, 0x6B, 0x7F, 0x7F, 0x36, 0x00}, // w
+  {0x00, 0x00, 0x63, 0x36, 0x1C, 0x36, 0x63, 0x00}, // x
+  {0x00, 0x00, 0x33, 0x33, 0x33, 0x3E, 0x30, 0x1F}, // y
+  {0x00, 0x00, 0x3F, 0x19, 0x0C, 0x26, 0x3F, 0x00}, // z
+  {0x38, 0x0C, 0x0C, 0x07, 0x0C, 0x0C, 0x38, 0x00}, // {
+  {0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00}, // |
+  {0x07, 0x0C, 0x0C, 0x38, 0x0C, 0x0C, 0x07, 0x00}, // }
+  {0x6E, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}  // ~
+};
+
+// expand every row byte into pixels of the current colors
+static void buildPattern(struct s_fbcon *p_con)
+{
+  for(uint32_t bits = 0; bits < 256; bits++)
+  {
+    for(uint32_t index = 0; index < FBCON_GLYPH_WIDTH; index++)
+    {
+      p_con->pattern[bits][index] = ((bits >> index) & 1 ? p_con->fg : p_con->bg);
+    }
+  }
+}
+
+// grow the dirty rows to include row
+static void markDirty(struct s_fbcon *p_con, uint16_t row)
+{
+  if(row < p_con->dirty_first) p_con->dirty_first = row;
+
+  if(row > p_con->dirty_last) p_con->dirty_last = row;
+}
+
+// carriage return and line feed, scrolling the ring at the bottom
+static void newLine(struct s_fbcon *p_con)
+{
+  p_con->col = 0;
+
+  if(p_con->row + 1 < FBCON_ROWS)
+  {
+    p_con->row++;
+
+    return;
+  }
+
+  scrollFbScroll(&p_con->scroll, FBCON_GLYPH_HEIGHT);
+
+  p_con->scrolled = 1;
+}
+
+// render a glyph at the cursor, each row is one cached pattern copied a word at a time
+static void drawGlyph(struct s_fbcon *p_con, uint8_t c)
+{
+  const uint8_t *p_glyph = g_fbcon_font[((c < ' ') || (c > '~') ? '?' : c) - ' '];
+
+  // the ring is the screen height and only scrolls by whole text rows, so a text row never wraps it.
+  uint32_t *p_dst = getFbScrollRow(&p_con->scroll, p_con->row * FBCON_GLYPH_HEIGHT) + p_con->col * FBCON_GLYPH_WIDTH;
+
+  for(uint32_t index = 0; index < FBCON_GLYPH_HEIGHT; index++, p_dst += XRES)
+  {
+    const uint32_t *p_src = p_con->pattern[p_glyph[index]];
+
+    p_dst[0] = p_src[0];
+    p_dst[1] = p_src[1];
+    p_dst[2] = p_src[2];
+    p_dst[3] = p_src[3];
+    p_dst[4] = p_src[4];
+    p_dst[5] = p_src[5];
+    p_dst[6] = p_src[6];
+    p_dst[7] = p_src[7];
+  }
+
+  markDirty(p_con, p_con->row);
+}
+
+// Initializes a console
+int initFbCon(struct s_fbcon *p_con, uint32_t fg, uint32_t bg)
+{
+  if(!p_con) return 1;
+
+  memset(p_con, 0, sizeof(*p_con));
+
+  if(initFbScroll(&p_con->scroll, YRES, YRES, bg)) return 1;
+
+  p_con->fg = fg;
+  p_con->bg = bg;
+
+  buildPattern(p_con);
+
+  p_con->dirty_first = FBCON_ROWS;
+
+  // whatever the framebuffer holds now is not the console.
+  p_con->scrolled = 1;
+
+  return 0;
+}
+
+// free the console memory
+void freeFbCon(struct s_fbcon *p_con)
+{
+  if(!p_con) return;
+
+  freeFbScroll(&p_con->scroll);
+}
+
+// set the colors for text put from now on
+void setFbConColor(struct s_fbcon *p_con, uint32_t fg, uint32_t bg)
+{
+  if(!p_con) return;
+
+  if((p_con->fg == fg) && (p_con->bg == bg)) return;
+
+  p_con->fg = fg;
+  p_con->bg = bg;
+
+  p_con->scroll.background = bg;
+
+  buildPattern(p_con);
+}
+
+// move the cursor
+void setFbConCursor(struct s_fbcon *p_con, uint16_t col, uint16_t row)
+{
+  if(!p_con) return;
+
+  p_con->col = (col < FBCON_COLS ? col : FBCON_COLS - 1);
+  p_con->row = (row < FBCON_ROWS ? row : FBCON_ROWS - 1);
+}
+
+// get the cursor position
+void getFbConCursor(struct s_fbcon *p_con, uint16_t *p_col, uint16_t *p_row)
+{
+  if(!p_con) return;
+
+  if(p_col) *p_col = p_con->col;
+
+  if(p_row) *p_row = p_con->row;
+}
+
+// clear the screen and home the cursor
+void clrFbCon(struct s_fbcon *p_con)
+{
+  if(!p_con) return;
+
+  if(!p_con->scroll.p_ring) return;
+
+  for(uint32_t row = 0; row < YRES; row++)
+  {
+    fillAxiTftVmemRect((uint32_t)getFbScrollRow(&p_con->scroll, row), 0, 0, XRES, 1, p_con->bg);
+  }
+
+  p_con->col = 0;
+  p_con->row = 0;
+
+  p_con->scrolled = 1;
+}
+
+// put one character at the cursor
+void putFbCon(struct s_fbcon *p_con, char c)
+{
+  if(!p_con) return;
+
+  if(!p_con->scroll.p_ring) return;
+
+  switch(c)
+  {
+    case '\n':
+      newLine(p_con);
+      return;
+    case '\r':
+      p_con->col = 0;
+      return;
+    case '\t':
+      if(p_con->col >= FBCON_COLS) newLine(p_con);
+      p_con->col = (p_con->col / FBCON_TAB + 1) * FBCON_TAB;
+      if(p_con->col > FBCON_COLS) p_con->col = FBCON_COLS;
+      return;
+    case '\b':
+      if(p_con->col) p_con->col--;
+      return;
+    default:
+      break;
+  }
+
+  // wrap only once there is something to put, a full line followed by \n stays one line.
+  if(p_con->col >= FBCON_COLS) newLine(p_con);
+
+  drawGlyph(p_con, (uint8_t)c);
+
+  p_con->col++;
+}
+
+// put a buffer of characters
+int writeFbCon(char *ptr, int len, void *p_ctx)
+{
+  struct s_fbcon *p_con = (struct s_fbcon *)p_ctx;
+
+  if(!p_con || !ptr || (len < 0)) return -1;
+
+  for(int index = 0; index < len; index++) putFbCon(p_con, ptr[index]);
+
+  return len;
+}
+
+// copy the changed text rows to a framebuffer
+uint32_t drawFbCon(struct s_fbcon *p_con, uint32_t vmem_addr, uint8_t full)
+{
+  uint32_t pixels = 0;
+
+  if(!p_con) return 0;
+
+  if(!p_con->scroll.p_ring) return 0;
+
+  if(full || p_con->scrolled)
+  {
+    pixels = drawFbScroll(&p_con->scroll, vmem_addr, 0);
+  }
+  else
+  {
+    for(uint32_t row = p_con->dirty_first; row <= p_con->dirty_last; row++)
+    {
+      blitAxiTftVmemRect(vmem_addr, 0, row * FBCON_GLYPH_HEIGHT, XRES, FBCON_GLYPH_HEIGHT, getFbScrollRow(&p_con->scroll, row * FBCON_GLYPH_HEIGHT), XRES);
+
+      pixels += XRES * FBCON_GLYPH_HEIGHT;
+    }
+  }
+
+  p_con->dirty_first = FBCON_ROWS;
+  p_con->dirty_last  = 0;
+
+  p_con->scrolled = 0;
+
+  return pixels;
+}
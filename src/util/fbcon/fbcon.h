@@ -0,0 +1,227 @@
+/***************************************************************************//**
+  * @file     fbcon.h
+  * @brief    AXI TFT text console
+  * @details  8x8 font console rendered through a colour-resolved row cache into a scroll ring.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __FBCON_H
+#define __FBCON_H
+
+#include <stdint.h>
+
+#include <axi_tft.h>
+#include <fbscroll.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def FBCON_GLYPH_WIDTH
+ * font width in pixels, one byte per glyph row.
+ */
+#define FBCON_GLYPH_WIDTH   8
+
+/**
+ * @def FBCON_GLYPH_HEIGHT
+ * font height in pixels.
+ */
+#define FBCON_GLYPH_HEIGHT  8
+
+/**
+ * @def FBCON_COLS
+ * text columns on the screen.
+ */
+#define FBCON_COLS  (XRES/FBCON_GLYPH_WIDTH)
+
+/**
+ * @def FBCON_ROWS
+ * text rows on the screen.
+ */
+#define FBCON_ROWS  (YRES/FBCON_GLYPH_HEIGHT)
+
+/**
+ * @def FBCON_TAB
+ * tab stops every this many columns.
+ */
+#define FBCON_TAB   8
+
+/**
+ * @struct s_fbcon
+ * @brief text console state, rendered into a scroll ring the size of the screen.
+ */
+struct s_fbcon
+{
+  /**
+   * @var s_fbcon::scroll
+   * rendered text, scrolling moves the ring instead of the pixels.
+   */
+  struct s_fbscroll scroll;
+  /**
+   * @var s_fbcon::pattern
+   * every glyph row byte expanded to pixels in the current colors.
+   */
+  uint32_t pattern[256][FBCON_GLYPH_WIDTH];
+  /**
+   * @var s_fbcon::fg
+   * a8r8g8b8 text color.
+   */
+  uint32_t fg;
+  /**
+   * @var s_fbcon::bg
+   * a8r8g8b8 background color.
+   */
+  uint32_t bg;
+  /**
+   * @var s_fbcon::col
+   * cursor column, FBCON_COLS means wrap before the next character.
+   */
+  uint16_t col;
+  /**
+   * @var s_fbcon::row
+   * cursor row.
+   */
+  uint16_t row;
+  /**
+   * @var s_fbcon::dirty_first
+   * first text row changed since the last drawFbCon.
+   */
+  uint16_t dirty_first;
+  /**
+   * @var s_fbcon::dirty_last
+   * last text row changed since the last drawFbCon, below dirty_first when clean.
+   */
+  uint16_t dirty_last;
+  /**
+   * @var s_fbcon::scrolled
+   * every row changed (scroll or clear) since the last drawFbCon.
+   */
+  uint8_t scrolled;
+};
+
+/*********************************************//**
+  * @brief Initializes a console, the scroll ring is
+  * allocated from the heap and cleared to bg.
+  *
+  * @param p_con console to init
+  * @param fg a8r8g8b8 text color.
+  * @param bg a8r8g8b8 background color.
+  *
+  * @return 0 on success, 1 on bad arguments or no memory.
+  *************************************************/
+int initFbCon(struct s_fbcon *p_con, uint32_t fg, uint32_t bg);
+
+/*********************************************//**
+  * @brief free the console memory.
+  *
+  * @param p_con console to free
+  *************************************************/
+void freeFbCon(struct s_fbcon *p_con);
+
+/*********************************************//**
+  * @brief set the colors for text put from now on,
+  * rebuilds the row cache only when they change.
+  * Text already on the screen keeps its colors.
+  *
+  * @param p_con console
+  * @param fg a8r8g8b8 text color.
+  * @param bg a8r8g8b8 background color.
+  *************************************************/
+void setFbConColor(struct s_fbcon *p_con, uint32_t fg, uint32_t bg);
+
+/*********************************************//**
+  * @brief move the cursor, clamped to the screen.
+  *
+  * @param p_con console
+  * @param col text column
+  * @param row text row
+  *************************************************/
+void setFbConCursor(struct s_fbcon *p_con, uint16_t col, uint16_t row);
+
+/*********************************************//**
+  * @brief get the cursor position.
+  *
+  * @param p_con console
+  * @param p_col set to the text column, may be NULL.
+  * @param p_row set to the text row, may be NULL.
+  *************************************************/
+void getFbConCursor(struct s_fbcon *p_con, uint16_t *p_col, uint16_t *p_row);
+
+/*********************************************//**
+  * @brief clear the screen to bg and home the cursor.
+  *
+  * @param p_con console
+  *************************************************/
+void clrFbCon(struct s_fbcon *p_con);
+
+/*********************************************//**
+  * @brief put one character at the cursor. Handles
+  * \\n (also returns the carriage), \\r, \\t and \\b,
+  * wraps at the right edge and scrolls at the bottom.
+  * Characters outside of printable ascii show as ?.
+  *
+  * @param p_con console
+  * @param c character to put.
+  *************************************************/
+void putFbCon(struct s_fbcon *p_con, char c);
+
+/*********************************************//**
+  * @brief put a buffer of characters, matches
+  * write_sink so setWriteSink(writeFbCon, p_con)
+  * puts stdout and stderr on the console.
+  *
+  * @param ptr characters to put.
+  * @param len number of characters.
+  * @param p_ctx console, a struct s_fbcon pointer.
+  *
+  * @return len, -1 on bad arguments.
+  *************************************************/
+int writeFbCon(char *ptr, int len, void *p_ctx);
+
+/*********************************************//**
+  * @brief copy the text rows changed since the last
+  * draw to a framebuffer, everything after a scroll.
+  * Putting characters only renders into the ring,
+  * call this once a frame.
+  *
+  * @param p_con console
+  * @param vmem_addr framebuffer base address.
+  * @param full copy every row, for a framebuffer that
+  * missed earlier draws (a fbflip back buffer).
+  *
+  * @return number of pixels copied.
+  *************************************************/
+uint32_t drawFbCon(struct s_fbcon *p_con, uint32_t vmem_addr, uint8_t full);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
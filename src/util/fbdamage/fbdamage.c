@@ -0,0 +1,223 @@
+/***************************************************************************//**
+  * @file     fbdamage.c
+  * @brief    AXI TFT damage tracking
+  * @details  Bounded list of dirty rectangles, merged as they are added, flushed by copying only those regions.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "fbdamage.h"
+
+// pixels in a rectangle
+static uint32_t rectArea(const struct s_fbdamage_rect *p_rect)
+{
+  return (uint32_t)p_rect->w * p_rect->h;
+}
+
+// smallest rectangle holding both, p_out may be either input.
+static void rectUnion(const struct s_fbdamage_rect *p_a, const struct s_fbdamage_rect *p_b, struct s_fbdamage_rect *p_out)
+{
+  uint32_t x0 = (p_a->x < p_b->x ? p_a->x : p_b->x);
+  uint32_t y0 = (p_a->y < p_b->y ? p_a->y : p_b->y);
+  uint32_t x1 = ((uint32_t)p_a->x + p_a->w > (uint32_t)p_b->x + p_b->w ? (uint32_t)p_a->x + p_a->w : (uint32_t)p_b->x + p_b->w);
+  uint32_t y1 = ((uint32_t)p_a->y + p_a->h > (uint32_t)p_b->y + p_b->h ? (uint32_t)p_a->y + p_a->h : (uint32_t)p_b->y + p_b->h);
+
+  p_out->x = (uint16_t)x0;
+  p_out->y = (uint16_t)y0;
+  p_out->w = (uint16_t)(x1 - x0);
+  p_out->h = (uint16_t)(y1 - y0);
+}
+
+// pixels both rectangles cover
+static uint32_t rectOverlap(const struct s_fbdamage_rect *p_a, const struct s_fbdamage_rect *p_b)
+{
+  uint32_t x0 = (p_a->x > p_b->x ? p_a->x : p_b->x);
+  uint32_t y0 = (p_a->y > p_b->y ? p_a->y : p_b->y);
+  uint32_t x1 = ((uint32_t)p_a->x + p_a->w < (uint32_t)p_b->x + p_b->w ? (uint32_t)p_a->x + p_a->w : (uint32_t)p_b->x + p_b->w);
+  uint32_t y1 = ((uint32_t)p_a->y + p_a->h < (uint32_t)p_b->y + p_b->h ? (uint32_t)p_a->y + p_a->h : (uint32_t)p_b->y + p_b->h);
+
+  if((x0 >= x1) || (y0 >= y1)) return 0;
+
+  return (x1 - x0) * (y1 - y0);
+}
+
+// undamaged pixels the union of two rectangles would copy.
+static uint32_t mergeCost(const struct s_fbdamage_rect *p_a, const struct s_fbdamage_rect *p_b)
+{
+  struct s_fbdamage_rect joined;
+
+  rectUnion(p_a, p_b, &joined);
+
+  return rectArea(&joined) - (rectArea(p_a) + rectArea(p_b) - rectOverlap(p_a, p_b));
+}
+
+// Initializes a damage list
+void initFbDamage(struct s_fbdamage *p_damage)
+{
+  if(!p_damage) return;
+
+  memset(p_damage, 0, sizeof(*p_damage));
+}
+
+// add a damaged rectangle
+void addFbDamage(struct s_fbdamage *p_damage, uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+{
+  struct s_fbdamage_rect rect;
+
+  uint32_t cost = 0;
+  uint32_t best_cost = 0;
+
+  uint8_t index = 0;
+  uint8_t best = 0;
+
+  if(!p_damage) return;
+
+  if((x >= XRES) || (y >= YRES)) return;
+
+  if(w > XRES - x) w = XRES - x;
+
+  if(h > YRES - y) h = YRES - y;
+
+  if(!w || !h) return;
+
+  rect.x = (uint16_t)x;
+  rect.y = (uint16_t)y;
+  rect.w = (uint16_t)w;
+  rect.h = (uint16_t)h;
+
+  // every pass either returns or removes one rectangle from the list.
+  for(;;)
+  {
+    for(index = 0; index < p_damage->count; index++)
+    {
+      if(mergeCost(&rect, &p_damage->rects[index]) <= FBDAMAGE_MERGE_SLACK) break;
+    }
+
+    if(index < p_damage->count)
+    {
+      // the grown rectangle may now reach others, go again.
+      rectUnion(&rect, &p_damage->rects[index], &rect);
+
+      p_damage->rects[index] = p_damage->rects[--p_damage->count];
+
+      continue;
+    }
+
+    if(p_damage->count < FBDAMAGE_MAX_RECTS)
+    {
+      p_damage->rects[p_damage->count++] = rect;
+
+      return;
+    }
+
+    // full, fold into the rectangle that grows the least.
+    best_cost = ~0u;
+
+    for(index = 0; index < p_damage->count; index++)
+    {
+      cost = mergeCost(&rect, &p_damage->rects[index]);
+
+      if(cost < best_cost)
+      {
+        best_cost = cost;
+        best = index;
+      }
+    }
+
+    rectUnion(&rect, &p_damage->rects[best], &rect);
+
+    p_damage->rects[best] = p_damage->rects[--p_damage->count];
+  }
+}
+
+// add every rectangle of another list
+void mergeFbDamage(struct s_fbdamage *p_damage, const struct s_fbdamage *p_other)
+{
+  uint8_t index = 0;
+
+  if(!p_damage) return;
+
+  if(!p_other) return;
+
+  for(index = 0; index < p_other->count; index++)
+  {
+    addFbDamage(p_damage, p_other->rects[index].x, p_other->rects[index].y, p_other->rects[index].w, p_other->rects[index].h);
+  }
+}
+
+// copy the damaged regions, then empty the list
+uint32_t flushFbDamage(struct s_fbdamage *p_damage, uint32_t vmem_addr, const uint32_t *p_src, uint32_t src_stride)
+{
+  uint32_t pixels = 0;
+
+  uint8_t index = 0;
+
+  if(!p_damage) return 0;
+
+  if(!vmem_addr) return 0;
+
+  if(!p_src) return 0;
+
+  for(index = 0; index < p_damage->count; index++)
+  {
+    struct s_fbdamage_rect *p_rect = &p_damage->rects[index];
+
+    blitAxiTftVmemRect(vmem_addr, p_rect->x, p_rect->y, p_rect->w, p_rect->h, p_src + (uint32_t)p_rect->y*src_stride + p_rect->x, src_stride);
+
+    pixels += rectArea(p_rect);
+  }
+
+  p_damage->count = 0;
+
+  return pixels;
+}
+
+// empty a damage list without copying
+void clrFbDamage(struct s_fbdamage *p_damage)
+{
+  if(!p_damage) return;
+
+  p_damage->count = 0;
+}
+
+// get the pixels a flush would copy
+uint32_t getFbDamageArea(const struct s_fbdamage *p_damage)
+{
+  uint32_t pixels = 0;
+
+  uint8_t index = 0;
+
+  if(!p_damage) return 0;
+
+  for(index = 0; index < p_damage->count; index++) pixels += rectArea(&p_damage->rects[index]);
+
+  return pixels;
+}
@@ -0,0 +1,174 @@
+/***************************************************************************//**
+  * @file     fbdamage.h
+  * @brief    AXI TFT damage tracking
+  * @details  Bounded list of dirty rectangles, merged as they are added, flushed by copying only those regions.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __FBDAMAGE_H
+#define __FBDAMAGE_H
+
+#include <stdint.h>
+
+#include <axi_tft.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def FBDAMAGE_MAX_RECTS
+ * rectangles kept before new damage is forced into the closest one.
+ */
+#ifndef FBDAMAGE_MAX_RECTS
+#define FBDAMAGE_MAX_RECTS  16
+#endif
+
+/**
+ * @def FBDAMAGE_MERGE_SLACK
+ * undamaged pixels a merge may add and still be done eagerly, copying
+ * a few extra pixels is cheaper than another row loop.
+ */
+#ifndef FBDAMAGE_MERGE_SLACK
+#define FBDAMAGE_MERGE_SLACK  1024
+#endif
+
+/**
+ * @struct s_fbdamage_rect
+ * @brief damaged rectangle, always inside XRES by YRES.
+ */
+struct s_fbdamage_rect
+{
+  /**
+   * @var s_fbdamage_rect::x
+   * left column
+   */
+  uint16_t x;
+  /**
+   * @var s_fbdamage_rect::y
+   * top row
+   */
+  uint16_t y;
+  /**
+   * @var s_fbdamage_rect::w
+   * width in pixels
+   */
+  uint16_t w;
+  /**
+   * @var s_fbdamage_rect::h
+   * height in pixels
+   */
+  uint16_t h;
+};
+
+/**
+ * @struct s_fbdamage
+ * @brief damage list, one per destination (or per flip buffer).
+ */
+struct s_fbdamage
+{
+  /**
+   * @var s_fbdamage::rects
+   * disjoint enough rectangles, count are valid.
+   */
+  struct s_fbdamage_rect rects[FBDAMAGE_MAX_RECTS];
+  /**
+   * @var s_fbdamage::count
+   * number of valid rectangles
+   */
+  uint8_t count;
+};
+
+/*********************************************//**
+  * @brief Initializes a damage list, empty.
+  *
+  * @param p_damage list to init
+  *************************************************/
+void initFbDamage(struct s_fbdamage *p_damage);
+
+/*********************************************//**
+  * @brief add a damaged rectangle, clipped to the
+  * screen. It is merged with every rectangle it can
+  * join for at most FBDAMAGE_MERGE_SLACK extra pixels,
+  * a full list merges it into the cheapest one.
+  *
+  * @param p_damage list to add to
+  * @param x left column
+  * @param y top row
+  * @param w width in pixels
+  * @param h height in pixels
+  *************************************************/
+void addFbDamage(struct s_fbdamage *p_damage, uint32_t x, uint32_t y, uint32_t w, uint32_t h);
+
+/*********************************************//**
+  * @brief add every rectangle of another list, to
+  * carry damage across more than one flip buffer.
+  *
+  * @param p_damage list to add to
+  * @param p_other list to add, not changed.
+  *************************************************/
+void mergeFbDamage(struct s_fbdamage *p_damage, const struct s_fbdamage *p_other);
+
+/*********************************************//**
+  * @brief copy the damaged regions from a source
+  * buffer to a framebuffer, then empty the list.
+  *
+  * @param p_damage list to flush
+  * @param vmem_addr destination framebuffer, XRES_VIR
+  * stride (vram, or a flip back buffer).
+  * @param p_src shadow or other flip buffer, same x/y.
+  * @param src_stride pixels between rows of p_src, XRES
+  * for a packed shadow, XRES_VIR for a flip buffer.
+  *
+  * @return number of pixels copied.
+  *************************************************/
+uint32_t flushFbDamage(struct s_fbdamage *p_damage, uint32_t vmem_addr, const uint32_t *p_src, uint32_t src_stride);
+
+/*********************************************//**
+  * @brief empty a damage list without copying.
+  *
+  * @param p_damage list to empty
+  *************************************************/
+void clrFbDamage(struct s_fbdamage *p_damage);
+
+/*********************************************//**
+  * @brief get the pixels a flush would copy.
+  *
+  * @param p_damage list to check
+  *
+  * @return damaged pixels, overlaps are counted once
+  * per rectangle.
+  *************************************************/
+uint32_t getFbDamageArea(const struct s_fbdamage *p_damage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
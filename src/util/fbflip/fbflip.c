@@ -0,0 +1,262 @@
+/***************************************************************************//**
+  * @file     fbflip.c
+  * @brief    AXI TFT page flipping
+  * @details  Double or triple buffered framebuffers for the AXI TFT, flipped at the frame interrupt.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stdlib.h>
+#include <malloc.h>
+#include <string.h>
+
+#include <riscv-csr.h>
+#include <clint_timer.h>
+
+#include "fbflip.h"
+
+// no buffer in that role
+#define FBFLIP_NONE -1
+
+// Writing the address register clears the status bit, the core
+// latches the address at the next vsync and sets it (and the irq).
+// So a flip is: write the address, wait for status, the old front
+// is now free. Only one address can be in flight, a third buffer
+// waits in queued until the pending one lands.
+static struct
+{
+  struct s_axi_tft *p_axi_tft;
+  uint32_t addr[FBFLIP_MAX_BUFS];
+  uint8_t num_bufs;
+  uint64_t poll;
+  int8_t back;
+  volatile int8_t front;
+  volatile int8_t pending;
+  volatile int8_t queued;
+  volatile uint32_t flips;
+} g_fbflip;
+
+// start scanning out a buffer, called with interrupts off.
+static void startFlip(int8_t index)
+{
+  // drawing must be in memory before the core can fetch it.
+  __asm__ volatile ("fence" ::: "memory");
+
+  setAxiTftVmemAddr(g_fbflip.p_axi_tft, g_fbflip.addr[index]);
+
+  g_fbflip.pending = index;
+
+  setAxiTftIntrEna(g_fbflip.p_axi_tft);
+}
+
+// is a buffer not on, or headed to, the screen.
+static int8_t findFree(void)
+{
+  int8_t index;
+
+  for(index = 0; index < g_fbflip.num_bufs; index++)
+  {
+    if(index == g_fbflip.front) continue;
+
+    if(index == g_fbflip.pending) continue;
+
+    if(index == g_fbflip.queued) continue;
+
+    return index;
+  }
+
+  return FBFLIP_NONE;
+}
+
+// wait condition, a buffer is free.
+static int freeCond(void *p_ctx)
+{
+  (void)p_ctx;
+
+  serviceFbFlip();
+
+  return findFree() != FBFLIP_NONE;
+}
+
+// wait condition, nothing left to flip.
+static int idleCond(void *p_ctx)
+{
+  (void)p_ctx;
+
+  serviceFbFlip();
+
+  return (g_fbflip.pending == FBFLIP_NONE) && (g_fbflip.queued == FBFLIP_NONE);
+}
+
+// Initializes page flipping
+int initFbFlip(struct s_axi_tft *p_axi_tft, uint8_t num_bufs, uint64_t poll)
+{
+  uint8_t index;
+
+  if(!p_axi_tft) return 1;
+
+  if((num_bufs < 2) || (num_bufs > FBFLIP_MAX_BUFS)) return 1;
+
+  memset(&g_fbflip, 0, sizeof(g_fbflip));
+
+  g_fbflip.back    = FBFLIP_NONE;
+  g_fbflip.pending = FBFLIP_NONE;
+  g_fbflip.queued  = FBFLIP_NONE;
+  g_fbflip.front   = 0;
+
+  // keep showing what is on screen until the first flip.
+  g_fbflip.addr[0] = getAxiTftVmemAddr(p_axi_tft);
+
+  for(index = 1; index < num_bufs; index++)
+  {
+    void *p_buf = memalign(FBFLIP_ALIGN, FBFLIP_SIZE);
+
+    if(!p_buf)
+    {
+      for(; index > 1; index--) free((void *)g_fbflip.addr[index-1]);
+
+      return 1;
+    }
+
+    g_fbflip.addr[index] = (uint32_t)p_buf;
+  }
+
+  g_fbflip.num_bufs  = num_bufs;
+  g_fbflip.poll      = poll;
+  g_fbflip.p_axi_tft = p_axi_tft;
+
+  // only on while a flip is in flight, the status stays set after.
+  unsetAxiTftIntrEna(p_axi_tft);
+
+  return 0;
+}
+
+// get the buffer to draw the next frame into
+uint32_t getFbFlipBack(void)
+{
+  uint32_t mstatus;
+
+  if(!g_fbflip.p_axi_tft) return 0;
+
+  if(g_fbflip.back != FBFLIP_NONE) return g_fbflip.addr[g_fbflip.back];
+
+  waitClintTimer(NULL, freeCond, NULL, CLINT_WAIT_FOREVER, g_fbflip.poll);
+
+  mstatus = csr_read_clr_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+
+  g_fbflip.back = findFree();
+
+  csr_set_bits_mstatus(mstatus & MSTATUS_MIE_BIT_MASK);
+
+  return g_fbflip.addr[g_fbflip.back];
+}
+
+// hand the back buffer to the display
+int submitFbFlip(void)
+{
+  uint32_t mstatus;
+
+  if(!g_fbflip.p_axi_tft) return 1;
+
+  if(g_fbflip.back == FBFLIP_NONE) return 1;
+
+  mstatus = csr_read_clr_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+
+  // a free back buffer means the queue slot is free too.
+  if(g_fbflip.pending == FBFLIP_NONE)
+  {
+    startFlip(g_fbflip.back);
+  }
+  else
+  {
+    g_fbflip.queued = g_fbflip.back;
+  }
+
+  g_fbflip.back = FBFLIP_NONE;
+
+  csr_set_bits_mstatus(mstatus & MSTATUS_MIE_BIT_MASK);
+
+  return 0;
+}
+
+// complete a pending flip and start the queued one
+uint8_t serviceFbFlip(void)
+{
+  uint32_t mstatus;
+
+  uint8_t done = 0;
+
+  if(!g_fbflip.p_axi_tft) return 0;
+
+  mstatus = csr_read_clr_bits_mstatus(MSTATUS_MIE_BIT_MASK);
+
+  if((g_fbflip.pending != FBFLIP_NONE) && getAxiTftStatus(g_fbflip.p_axi_tft))
+  {
+    g_fbflip.front   = g_fbflip.pending;
+    g_fbflip.pending = FBFLIP_NONE;
+
+    g_fbflip.flips++;
+
+    done = 1;
+
+    if(g_fbflip.queued != FBFLIP_NONE)
+    {
+      startFlip(g_fbflip.queued);
+
+      g_fbflip.queued = FBFLIP_NONE;
+    }
+    else
+    {
+      unsetAxiTftIntrEna(g_fbflip.p_axi_tft);
+    }
+  }
+
+  csr_set_bits_mstatus(mstatus & MSTATUS_MIE_BIT_MASK);
+
+  return done;
+}
+
+// wait until every submitted buffer is on screen
+void waitFbFlip(void)
+{
+  if(!g_fbflip.p_axi_tft) return;
+
+  waitClintTimer(NULL, idleCond, NULL, CLINT_WAIT_FOREVER, g_fbflip.poll);
+}
+
+// get the buffer being scanned out
+uint32_t getFbFlipFront(void)
+{
+  return g_fbflip.addr[g_fbflip.front];
+}
+
+// get the number of completed flips
+uint32_t getFbFlipCount(void)
+{
+  return g_fbflip.flips;
+}
@@ -0,0 +1,134 @@
+/***************************************************************************//**
+  * @file     fbflip.h
+  * @brief    AXI TFT page flipping
+  * @details  Double or triple buffered framebuffers for the AXI TFT, flipped at the frame interrupt.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __FBFLIP_H
+#define __FBFLIP_H
+
+#include <stdint.h>
+
+#include <axi_tft.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def FBFLIP_MAX_BUFS
+ * most framebuffers, 3 is triple buffering.
+ */
+#define FBFLIP_MAX_BUFS 3
+
+/**
+ * @def FBFLIP_ALIGN
+ * the core only takes 2MB aligned base addresses.
+ */
+#define FBFLIP_ALIGN    0x200000
+
+/**
+ * @def FBFLIP_SIZE
+ * bytes in one framebuffer, rows are XRES_VIR pixels apart.
+ */
+#define FBFLIP_SIZE     (XRES_VIR*YRES_VIR*sizeof(uint32_t))
+
+/*********************************************//**
+  * @brief Initializes page flipping. The buffer the core
+  * scans now is the first front buffer, the rest are
+  * allocated 2MB aligned from the heap.
+  *
+  * Call serviceFbFlip from the TFT interrupt handler, or
+  * give a poll interval when the interrupt is not wired.
+  *
+  * @param p_axi_tft pre initialized struct from initAxiTft
+  * @param num_bufs 2 for double, 3 for triple buffering.
+  * @param poll mtime ticks between status checks while
+  * waiting, 0 when serviceFbFlip runs from the interrupt.
+  *
+  * @return 0 on success, 1 on bad arguments or no memory.
+  *************************************************/
+int initFbFlip(struct s_axi_tft *p_axi_tft, uint8_t num_bufs, uint64_t poll);
+
+/*********************************************//**
+  * @brief get the buffer to draw the next frame into,
+  * waiting (wfi, see waitClintTimer) until one is off
+  * screen. The same buffer is returned until submitted.
+  * Its contents are whatever was last drawn into it.
+  *
+  * @return base address of the back buffer, 0 if not
+  * initialized.
+  *************************************************/
+uint32_t getFbFlipBack(void);
+
+/*********************************************//**
+  * @brief hand the back buffer to the display. It goes
+  * on screen at the next frame, or the one after that
+  * if another flip is still pending (triple buffering).
+  *
+  * @return 0 on success, 1 if no back buffer is held.
+  *************************************************/
+int submitFbFlip(void);
+
+/*********************************************//**
+  * @brief complete a pending flip once the core has
+  * latched the new address, and start the queued one.
+  * Call from the TFT interrupt handler, it is also
+  * called while waiting so polling works without it.
+  *
+  * @return 1 if a flip completed, 0 otherwise.
+  *************************************************/
+uint8_t serviceFbFlip(void);
+
+/*********************************************//**
+  * @brief wait until every submitted buffer has been
+  * put on screen.
+  *************************************************/
+void waitFbFlip(void);
+
+/*********************************************//**
+  * @brief get the buffer being scanned out.
+  *
+  * @return base address of the front buffer.
+  *************************************************/
+uint32_t getFbFlipFront(void);
+
+/*********************************************//**
+  * @brief get the number of completed flips.
+  *
+  * @return flip count
+  *************************************************/
+uint32_t getFbFlipCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,164 @@
+/***************************************************************************//**
+  * @file     fbscroll.c
+  * @brief    AXI TFT scroll ring
+  * @details  Ring of screen rows in DDR, scrolling only renders the rows it exposes.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "fbscroll.h"
+
+// ring row for a view row
+static uint32_t ringRow(struct s_fbscroll *p_scroll, uint32_t row)
+{
+  row += p_scroll->top;
+
+  return (row >= p_scroll->ring_rows ? row - p_scroll->ring_rows : row);
+}
+
+// Initializes a scroll ring
+int initFbScroll(struct s_fbscroll *p_scroll, uint32_t ring_rows, uint32_t view_rows, uint32_t background)
+{
+  if(!p_scroll) return 1;
+
+  if(!view_rows || (view_rows > YRES) || (ring_rows < view_rows)) return 1;
+
+  memset(p_scroll, 0, sizeof(*p_scroll));
+
+  p_scroll->p_ring = malloc(ring_rows * XRES * sizeof(uint32_t));
+
+  if(!p_scroll->p_ring) return 1;
+
+  p_scroll->ring_rows  = ring_rows;
+  p_scroll->view_rows  = view_rows;
+  p_scroll->background = background;
+
+  fillAxiTftVmemRect((uint32_t)p_scroll->p_ring, 0, 0, XRES, 1, background);
+
+  for(uint32_t row = 1; row < ring_rows; row++) memcpy(&p_scroll->p_ring[row * XRES], p_scroll->p_ring, XRES * sizeof(uint32_t));
+
+  return 0;
+}
+
+// free the ring memory
+void freeFbScroll(struct s_fbscroll *p_scroll)
+{
+  if(!p_scroll) return;
+
+  free(p_scroll->p_ring);
+
+  p_scroll->p_ring = NULL;
+}
+
+// get a row of the view to render into
+uint32_t *getFbScrollRow(struct s_fbscroll *p_scroll, uint32_t row)
+{
+  if(!p_scroll) return NULL;
+
+  if(!p_scroll->p_ring) return NULL;
+
+  if(row >= p_scroll->view_rows) return NULL;
+
+  return &p_scroll->p_ring[ringRow(p_scroll, row) * XRES];
+}
+
+// scroll the view down, clearing only the rows it exposes
+void scrollFbScroll(struct s_fbscroll *p_scroll, uint32_t rows)
+{
+  uint32_t kept = 0;
+
+  if(!p_scroll) return;
+
+  if(!p_scroll->p_ring) return;
+
+  if(rows > p_scroll->view_rows) rows = p_scroll->view_rows;
+
+  kept = (rows < p_scroll->ahead ? rows : p_scroll->ahead);
+
+  p_scroll->ahead -= kept;
+
+  p_scroll->top = ringRow(p_scroll, rows);
+
+  p_scroll->history += rows;
+
+  // new rows overwrite the oldest history.
+  if(p_scroll->history > p_scroll->ring_rows - p_scroll->view_rows - p_scroll->ahead) p_scroll->history = p_scroll->ring_rows - p_scroll->view_rows - p_scroll->ahead;
+
+  // the exposed rows past what an unscroll left behind are new.
+  for(uint32_t row = p_scroll->view_rows - rows + kept; row < p_scroll->view_rows; row++)
+  {
+    fillAxiTftVmemRect((uint32_t)getFbScrollRow(p_scroll, row), 0, 0, XRES, 1, p_scroll->background);
+  }
+}
+
+// scroll the view back up into the history
+void unscrollFbScroll(struct s_fbscroll *p_scroll, uint32_t rows)
+{
+  if(!p_scroll) return;
+
+  if(!p_scroll->p_ring) return;
+
+  if(rows > p_scroll->history) rows = p_scroll->history;
+
+  p_scroll->history -= rows;
+
+  p_scroll->ahead += rows;
+
+  if(p_scroll->ahead > p_scroll->ring_rows - p_scroll->view_rows) p_scroll->ahead = p_scroll->ring_rows - p_scroll->view_rows;
+
+  p_scroll->top = ringRow(p_scroll, p_scroll->ring_rows - rows);
+}
+
+// copy the view to a framebuffer
+uint32_t drawFbScroll(struct s_fbscroll *p_scroll, uint32_t vmem_addr, uint32_t y)
+{
+  uint32_t first = 0;
+
+  if(!p_scroll) return 0;
+
+  if(!p_scroll->p_ring) return 0;
+
+  if(!vmem_addr) return 0;
+
+  // rows from top to the end of the ring, then the wrapped rest from the start.
+  first = p_scroll->ring_rows - p_scroll->top;
+
+  if(first > p_scroll->view_rows) first = p_scroll->view_rows;
+
+  blitAxiTftVmemRect(vmem_addr, 0, y, XRES, first, &p_scroll->p_ring[p_scroll->top * XRES], XRES);
+
+  if(first < p_scroll->view_rows)
+  {
+    blitAxiTftVmemRect(vmem_addr, 0, y + first, XRES, p_scroll->view_rows - first, p_scroll->p_ring, XRES);
+  }
+
+  return XRES * p_scroll->view_rows;
+}
@@ -0,0 +1,157 @@
+/***************************************************************************//**
+  * @file     fbscroll.h
+  * @brief    AXI TFT scroll ring
+  * @details  Ring of screen rows in DDR, scrolling only renders the rows it exposes.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __FBSCROLL_H
+#define __FBSCROLL_H
+
+#include <stdint.h>
+
+#include <axi_tft.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct s_fbscroll
+ * @brief ring of XRES wide rows, a view_rows tall window of it is shown.
+ */
+struct s_fbscroll
+{
+  /**
+   * @var s_fbscroll::p_ring
+   * ring rows, XRES pixels apart.
+   */
+  uint32_t *p_ring;
+  /**
+   * @var s_fbscroll::ring_rows
+   * rows in the ring, at least view_rows.
+   */
+  uint32_t ring_rows;
+  /**
+   * @var s_fbscroll::view_rows
+   * rows shown by drawFbScroll.
+   */
+  uint32_t view_rows;
+  /**
+   * @var s_fbscroll::top
+   * ring row at the top of the view.
+   */
+  uint32_t top;
+  /**
+   * @var s_fbscroll::history
+   * valid rows above the view.
+   */
+  uint32_t history;
+  /**
+   * @var s_fbscroll::ahead
+   * valid rows below the view, after unscrollFbScroll.
+   */
+  uint32_t ahead;
+  /**
+   * @var s_fbscroll::background
+   * color newly exposed rows are cleared to.
+   */
+  uint32_t background;
+};
+
+/*********************************************//**
+  * @brief Initializes a scroll ring, allocated from the
+  * heap and cleared to the background.
+  *
+  * @param p_scroll ring to init
+  * @param ring_rows rows kept, at least view_rows. Rows
+  * past the view are history that scrolls back in free.
+  * @param view_rows rows shown, YRES for the whole screen.
+  * @param background a8r8g8b8 color for cleared rows.
+  *
+  * @return 0 on success, 1 on bad arguments or no memory.
+  *************************************************/
+int initFbScroll(struct s_fbscroll *p_scroll, uint32_t ring_rows, uint32_t view_rows, uint32_t background);
+
+/*********************************************//**
+  * @brief free the ring memory.
+  *
+  * @param p_scroll ring to free
+  *************************************************/
+void freeFbScroll(struct s_fbscroll *p_scroll);
+
+/*********************************************//**
+  * @brief get a row of the view to render into.
+  *
+  * @param p_scroll ring
+  * @param row 0 is the top of the view.
+  *
+  * @return XRES pixels, NULL if row is outside the view.
+  *************************************************/
+uint32_t *getFbScrollRow(struct s_fbscroll *p_scroll, uint32_t row);
+
+/*********************************************//**
+  * @brief scroll the view down, the rows it exposes at
+  * the bottom are cleared and are all that need
+  * rendering (rows still there from an unscroll are
+  * kept). Nothing is copied.
+  *
+  * @param p_scroll ring
+  * @param rows rows to scroll, clamped to view_rows.
+  *************************************************/
+void scrollFbScroll(struct s_fbscroll *p_scroll, uint32_t rows);
+
+/*********************************************//**
+  * @brief scroll the view back up into the history,
+  * nothing is rendered or cleared.
+  *
+  * @param p_scroll ring
+  * @param rows rows to scroll, clamped to the history.
+  *************************************************/
+void unscrollFbScroll(struct s_fbscroll *p_scroll, uint32_t rows);
+
+/*********************************************//**
+  * @brief copy the view to a framebuffer, at most two
+  * blits (the view can wrap the ring). Draw into a
+  * fbflip back buffer so the new position shows at a
+  * frame boundary.
+  *
+  * @param p_scroll ring
+  * @param vmem_addr framebuffer base address.
+  * @param y screen row for the top of the view.
+  *
+  * @return number of pixels copied.
+  *************************************************/
+uint32_t drawFbScroll(struct s_fbscroll *p_scroll, uint32_t vmem_addr, uint32_t y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,200 @@
+/***************************************************************************//**
+  * @file     ftrace.c
+  * @brief    Function entry/exit cycle trace
+  * @details  -finstrument-functions hooks that record function address and mcycle into a circular buffer.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <riscv-csr.h>
+
+#include "ftrace.h"
+
+// nothing in here may be instrumented, it would recurse into the hooks.
+#define FTRACE_NO_TRACE __attribute__((no_instrument_function))
+
+static struct
+{
+  struct s_ftrace_entry *p_buf;
+  uint32_t mask;
+  uint32_t head;
+  volatile uint32_t enabled;
+} g_ftrace;
+
+void __cyg_profile_func_enter(void *p_fn, void *p_site) FTRACE_NO_TRACE;
+void __cyg_profile_func_exit(void *p_fn, void *p_site) FTRACE_NO_TRACE;
+
+// record one entry, an atomic add claims the slot so interrupts can trace too.
+static inline __attribute__((always_inline)) void addEntry(uint32_t addr)
+{
+  uint32_t cycle;
+  uint32_t index;
+
+  // stopped tracing costs a load and a branch per call, no csr read.
+  if(!g_ftrace.enabled) return;
+
+  cycle = (uint32_t)csr_read_mcycle();
+
+  index = __atomic_fetch_add(&g_ftrace.head, 1, __ATOMIC_RELAXED) & g_ftrace.mask;
+
+  g_ftrace.p_buf[index].addr  = addr;
+  g_ftrace.p_buf[index].cycle = cycle;
+}
+
+// -finstrument-functions entry hook
+void __cyg_profile_func_enter(void *p_fn, void *p_site)
+{
+  (void)p_site;
+
+  addEntry((uint32_t)p_fn);
+}
+
+// -finstrument-functions exit hook
+void __cyg_profile_func_exit(void *p_fn, void *p_site)
+{
+  (void)p_site;
+
+  addEntry((uint32_t)p_fn | FTRACE_EXIT);
+}
+
+// Initializes the trace buffer
+int initFtrace(uint32_t entries)
+{
+  uint32_t slots = 1;
+
+  if(!entries) return 1;
+
+  freeFtrace();
+
+  while(slots < entries) slots <<= 1;
+
+  g_ftrace.p_buf = calloc(slots, sizeof(struct s_ftrace_entry));
+
+  if(!g_ftrace.p_buf) return 1;
+
+  g_ftrace.mask = slots - 1;
+  g_ftrace.head = 0;
+
+  return 0;
+}
+
+// stop tracing and free the buffer
+void freeFtrace(void)
+{
+  g_ftrace.enabled = 0;
+
+  free(g_ftrace.p_buf);
+
+  g_ftrace.p_buf = NULL;
+  g_ftrace.mask  = 0;
+  g_ftrace.head  = 0;
+}
+
+// start recording
+void startFtrace(void)
+{
+  if(!g_ftrace.p_buf) return;
+
+  g_ftrace.enabled = 1;
+}
+
+// stop recording
+void stopFtrace(void)
+{
+  g_ftrace.enabled = 0;
+}
+
+// drop all records
+void clrFtrace(void)
+{
+  g_ftrace.head = 0;
+}
+
+// number of records written since the last clear
+uint32_t getFtraceCount(void)
+{
+  return g_ftrace.head;
+}
+
+// write the records as text lines
+int dumpFtrace(ftrace_write write, void *p_ctx)
+{
+  int len;
+  uint32_t index;
+  uint32_t first = 0;
+  uint32_t count = g_ftrace.head;
+  char line[FTRACE_LINE_SIZE];
+
+  if(!write) return 1;
+
+  if(!g_ftrace.p_buf) return 1;
+
+  // wrapped, the oldest record is the next one to be overwritten.
+  if(count > g_ftrace.mask + 1)
+  {
+    first = count;
+    count = g_ftrace.mask + 1;
+  }
+
+  len = snprintf(line, sizeof(line), "FTRACE BEGIN %lu %lu\n\r", (unsigned long)count, (unsigned long)g_ftrace.head);
+
+  if(write(p_ctx, line, len)) return 1;
+
+  for(index = 0; index < count; index++)
+  {
+    struct s_ftrace_entry *p_entry = &g_ftrace.p_buf[(first + index) & g_ftrace.mask];
+
+    len = snprintf(line, sizeof(line), "T %08lx %08lx\n\r", (unsigned long)p_entry->addr, (unsigned long)p_entry->cycle);
+
+    if(write(p_ctx, line, len)) return 1;
+  }
+
+  len = snprintf(line, sizeof(line), "FTRACE END\n\r");
+
+  return write(p_ctx, line, len);
+}
+
+// stdout output for dumpFtrace
+static int writeStdout(void *p_ctx, const char *p_buf, uint32_t len)
+{
+  (void)p_ctx;
+
+  return (fwrite(p_buf, 1, len, stdout) != len);
+}
+
+// dump over the uart
+void printFtrace(void)
+{
+  dumpFtrace(writeStdout, NULL);
+
+  fflush(stdout);
+}
@@ -0,0 +1,137 @@
+/***************************************************************************//**
+  * @file     ftrace.h
+  * @brief    Function entry/exit cycle trace
+  * @details  -finstrument-functions hooks that record function address and mcycle into a circular buffer.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __FTRACE_H
+#define __FTRACE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def FTRACE_EXIT
+ * set in s_ftrace_entry::addr for a function exit, code is at least 2 byte aligned.
+ */
+#define FTRACE_EXIT       1
+
+/**
+ * @def FTRACE_LINE_SIZE
+ * largest line produced by dumpFtrace.
+ */
+#define FTRACE_LINE_SIZE  48
+
+/**
+ * @struct s_ftrace_entry
+ * @brief one trace record
+ */
+struct s_ftrace_entry
+{
+  /**
+  * @var s_ftrace_entry::addr
+  * function address, FTRACE_EXIT set on exit
+  */
+  uint32_t addr;
+  /**
+  * @var s_ftrace_entry::cycle
+  * low 32 bits of mcycle
+  */
+  uint32_t cycle;
+};
+
+/**
+ * @typedef ftrace_write
+ * @brief output for dumpFtrace, return 0 on success.
+ */
+typedef int (*ftrace_write)(void *p_ctx, const char *p_buf, uint32_t len);
+
+/*********************************************//**
+  * @brief Initializes the trace buffer, tracing starts stopped.
+  *
+  * @param entries number of records, rounded up to a power of 2.
+  *
+  * @return 0 on success
+  *************************************************/
+int initFtrace(uint32_t entries);
+
+/*********************************************//**
+  * @brief stop tracing and free the buffer
+  *************************************************/
+void freeFtrace(void);
+
+/*********************************************//**
+  * @brief start recording, old records are overwritten once the buffer wraps.
+  *************************************************/
+void startFtrace(void);
+
+/*********************************************//**
+  * @brief stop recording, keeps the buffer for a dump.
+  * Call it right after the event of interest to freeze the trace.
+  *************************************************/
+void stopFtrace(void);
+
+/*********************************************//**
+  * @brief drop all records
+  *************************************************/
+void clrFtrace(void);
+
+/*********************************************//**
+  * @brief number of records written since the last clear,
+  * can be larger than the buffer.
+  *
+  * @return record count
+  *************************************************/
+uint32_t getFtraceCount(void);
+
+/*********************************************//**
+  * @brief write the records, oldest first, as text lines
+  * in the format read by ftrace.py. Stop tracing first.
+  *
+  * @param write output function
+  * @param p_ctx passed to write
+  *
+  * @return 0 on success
+  *************************************************/
+int dumpFtrace(ftrace_write write, void *p_ctx);
+
+/*********************************************//**
+  * @brief dump over the uart (stdout)
+  *************************************************/
+void printFtrace(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+################################################################################
+### date      2026.10.19
+### author    Jay Convertino
+### brief     Decode a ftrace dump into a timeline or flame graph input
+################################################################################
+#
+# usage
+#   ftrace.py app.elf uart.log                      timeline
+#   ftrace.py --folded app.elf uart.log > out.txt   flamegraph.pl / speedscope input
+#   ftrace.py --chrome out.json app.elf uart.log    chrome://tracing / perfetto
+#
+# The dump is the text printFtrace produced, other lines in a captured uart log
+# are ignored. If there are several dumps the last is used. Cycle stamps are the
+# low 32 bits of mcycle, a gap of more than 2^32 cycles between records is lost.
+
+import argparse
+import bisect
+import json
+import subprocess
+import sys
+from collections import Counter
+
+FTRACE_EXIT = 1
+
+
+def read_dump(path):
+    lines = open(path, errors="replace") if path != "-" else sys.stdin
+    dump = None
+    block = None
+    for line in lines:
+        words = line.strip().split()
+        if not words:
+            continue
+        if words[0] == "FTRACE" and len(words) > 1 and words[1] == "BEGIN":
+            block = {"count": int(words[2]), "written": int(words[3]), "records": []}
+        elif block is None:
+            continue
+        elif words[0] == "FTRACE" and len(words) > 1 and words[1] == "END":
+            dump = block
+            block = None
+        elif words[0] == "T":
+            block["records"].append((int(words[1], 16), int(words[2], 16)))
+    if dump is None:
+        sys.exit("no complete FTRACE BEGIN/END block in " + path)
+    return dump
+
+
+class Symbols:
+    def __init__(self, nm, elf):
+        out = subprocess.run([nm, "-n", "--defined-only", elf], check=True, capture_output=True, text=True).stdout
+        self.addrs = []
+        self.names = []
+        for line in out.splitlines():
+            words = line.split()
+            if len(words) == 3 and words[1] in "tTwW":
+                self.addrs.append(int(words[0], 16))
+                self.names.append(words[2])
+
+    def lookup(self, addr):
+        index = bisect.bisect_right(self.addrs, addr) - 1
+        if index < 0 or self.addrs[index] != addr:
+            return "?%08x" % addr
+        return self.names[index]
+
+
+def build_frames(records, syms):
+    # frames are (depth, start, end, name, child cycles), times relative to the first record.
+    frames = []
+    stack = []
+    if not records:
+        return frames, 0
+    now = 0
+    last = records[0][1]
+    for addr, cycle in records:
+        now += (cycle - last) & 0xFFFFFFFF
+        last = cycle
+        fn = addr & ~FTRACE_EXIT
+        if not addr & FTRACE_EXIT:
+            stack.append([syms.lookup(fn), fn, now, 0])
+            continue
+        # an exit whose entry was overwritten when the buffer wrapped, it began before the trace.
+        if not any(frame[1] == fn for frame in stack):
+            stack.insert(0, [syms.lookup(fn), fn, 0, 0])
+        # unwind frames that never logged an exit (longjmp, a task switch).
+        while stack[-1][1] != fn:
+            frame = stack.pop()
+            frames.append((len(stack), frame[2], now, frame[0], frame[3]))
+            if stack:
+                stack[-1][3] += now - frame[2]
+        frame = stack.pop()
+        frames.append((len(stack), frame[2], now, frame[0], frame[3]))
+        if stack:
+            stack[-1][3] += now - frame[2]
+    # still running when the trace stopped
+    while stack:
+        frame = stack.pop()
+        frames.append((len(stack), frame[2], now, frame[0], frame[3]))
+        if stack:
+            stack[-1][3] += now - frame[2]
+    frames.sort(key=lambda frame: (frame[1], frame[0]))
+    return frames, now
+
+
+def folded(frames):
+    stacks = Counter()
+    path = []
+    for depth, start, end, name, child in frames:
+        del path[depth:]
+        path.append(name)
+        self_cycles = (end - start) - child
+        if self_cycles > 0:
+            stacks[";".join(path)] += self_cycles
+    for stack, cycles in sorted(stacks.items()):
+        print("%s %d" % (stack, cycles))
+
+
+def timeline(frames, mhz):
+    print("%12s %10s %10s  %s" % ("start cyc", "cycles", "us", "function"))
+    for depth, start, end, name, child in frames:
+        print("%12d %10d %10.2f  %s%s" % (start, end - start, (end - start) / mhz, "  " * depth, name))
+
+
+def chrome(frames, mhz, path):
+    events = []
+    for depth, start, end, name, child in frames:
+        events.append({"name": name, "ph": "X", "ts": start / mhz, "dur": (end - start) / mhz, "pid": 0, "tid": 0})
+    with open(path, "w") as out:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ns"}, out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="decode a ftrace dump")
+    parser.add_argument("elf", help="app .elf the dump was taken from")
+    parser.add_argument("dump", help="uart log, - for stdin")
+    parser.add_argument("--prefix", default="riscv-none-elf-", help="cross toolchain prefix for nm")
+    parser.add_argument("--mhz", type=float, default=100.0, help="cpu clock for us columns")
+    parser.add_argument("--folded", action="store_true", help="print folded stacks weighted by self cycles")
+    parser.add_argument("--chrome", metavar="JSON", help="write a chrome trace event file")
+    args = parser.parse_args()
+
+    dump = read_dump(args.dump)
+    syms = Symbols(args.prefix + "nm", args.elf)
+    frames, total = build_frames(dump["records"], syms)
+
+    if args.chrome:
+        chrome(frames, args.mhz, args.chrome)
+
+    if args.folded:
+        folded(frames)
+    elif not args.chrome:
+        print("%d records (%d written), %d cycles" % (len(dump["records"]), dump["written"], total))
+        timeline(frames, args.mhz)
+
+
+if __name__ == "__main__":
+    main()
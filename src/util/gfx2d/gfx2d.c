@@ -0,0 +1,610 @@
+/***************************************************************************//**
+  * @file     gfx2d.c
+  * @brief    2D drawing primitives
+  * @details  Lines, rects, circles and clipped, color keyed and alpha blended blits on a8r8g8b8 surfaces.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stdlib.h>
+
+#include "gfx2d.h"
+
+// clip rectangle sides a point is past
+#define OUT_LEFT    1
+#define OUT_RIGHT   2
+#define OUT_TOP     4
+#define OUT_BOTTOM  8
+
+// a8r8g8b8 lanes blended with one multiply each, red and blue share a word.
+#define RB_MASK     0x00FF00FF
+#define G_MASK      0x0000FF00
+#define A_MASK      0xFF000000
+
+// pixel address on the surface
+static inline uint32_t *pixelAt(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y)
+{
+  return &p_gfx2d->p_pixels[(uint32_t)y * p_gfx2d->stride + (uint32_t)x];
+}
+
+// fill count words, eight at a time
+static inline void fillSpan(uint32_t *p_dst, uint32_t count, uint32_t color)
+{
+  for(; count >= 8; count -= 8, p_dst += 8)
+  {
+    p_dst[0] = color;
+    p_dst[1] = color;
+    p_dst[2] = color;
+    p_dst[3] = color;
+    p_dst[4] = color;
+    p_dst[5] = color;
+    p_dst[6] = color;
+    p_dst[7] = color;
+  }
+
+  while(count--) *p_dst++ = color;
+}
+
+// copy count words, eight at a time
+static inline void copySpan(uint32_t *p_dst, const uint32_t *p_src, uint32_t count)
+{
+  for(; count >= 8; count -= 8, p_dst += 8, p_src += 8)
+  {
+    p_dst[0] = p_src[0];
+    p_dst[1] = p_src[1];
+    p_dst[2] = p_src[2];
+    p_dst[3] = p_src[3];
+    p_dst[4] = p_src[4];
+    p_dst[5] = p_src[5];
+    p_dst[6] = p_src[6];
+    p_dst[7] = p_src[7];
+  }
+
+  while(count--) *p_dst++ = *p_src++;
+}
+
+// 8 bit alpha to 0 to 256, so 255 is all source and the blend is a shift.
+static inline uint32_t scaleAlpha(uint32_t alpha)
+{
+  return alpha + (alpha >> 7);
+}
+
+// (dst * (256 - a) + src * a) / 256 on red and blue, then green, keeping the dst alpha byte.
+static inline uint32_t blendPixel(uint32_t dst, uint32_t src, uint32_t alpha)
+{
+  uint32_t inv = 256 - alpha;
+
+  uint32_t rb = ((dst & RB_MASK) * inv + (src & RB_MASK) * alpha) >> 8;
+  uint32_t g  = ((dst & G_MASK)  * inv + (src & G_MASK)  * alpha) >> 8;
+
+  return (rb & RB_MASK) | (g & G_MASK) | (dst & A_MASK);
+}
+
+// cut a rect to the clip rectangle, moving the source offset with it. 0 when nothing is left.
+static int clipRect(struct s_gfx2d *p_gfx2d, int32_t *p_x, int32_t *p_y, int32_t *p_w, int32_t *p_h, int32_t *p_src_x, int32_t *p_src_y)
+{
+  int32_t x0 = *p_x;
+  int32_t y0 = *p_y;
+  int32_t x1 = *p_x + *p_w;
+  int32_t y1 = *p_y + *p_h;
+
+  if(x0 < p_gfx2d->clip_x0) x0 = p_gfx2d->clip_x0;
+  if(y0 < p_gfx2d->clip_y0) y0 = p_gfx2d->clip_y0;
+  if(x1 > p_gfx2d->clip_x1) x1 = p_gfx2d->clip_x1;
+  if(y1 > p_gfx2d->clip_y1) y1 = p_gfx2d->clip_y1;
+
+  if((x0 >= x1) || (y0 >= y1)) return 0;
+
+  if(p_src_x) *p_src_x = x0 - *p_x;
+  if(p_src_y) *p_src_y = y0 - *p_y;
+
+  *p_x = x0;
+  *p_y = y0;
+  *p_w = x1 - x0;
+  *p_h = y1 - y0;
+
+  return 1;
+}
+
+// which sides of the clip rectangle a point is past
+static uint32_t outCode(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y)
+{
+  uint32_t code = 0;
+
+  if(x < p_gfx2d->clip_x0) code |= OUT_LEFT;
+  else if(x >= p_gfx2d->clip_x1) code |= OUT_RIGHT;
+
+  if(y < p_gfx2d->clip_y0) code |= OUT_TOP;
+  else if(y >= p_gfx2d->clip_y1) code |= OUT_BOTTOM;
+
+  return code;
+}
+
+// floor and ceil of n / d for d > 0, C division truncates towards zero.
+static int64_t floorDiv(int64_t n, int64_t d)
+{
+  return (n >= 0 ? n / d : -((-n + d - 1) / d));
+}
+
+static int64_t ceilDiv(int64_t n, int64_t d)
+{
+  return -floorDiv(-n, d);
+}
+
+// the eight mirrored points of a circle octant, unchecked when the whole circle is inside the clip.
+static void plotCircle(struct s_gfx2d *p_gfx2d, int32_t cx, int32_t cy, int32_t x, int32_t y, uint32_t color, int inside)
+{
+  if(inside)
+  {
+    *pixelAt(p_gfx2d, cx + x, cy + y) = color;
+    *pixelAt(p_gfx2d, cx - x, cy + y) = color;
+    *pixelAt(p_gfx2d, cx + x, cy - y) = color;
+    *pixelAt(p_gfx2d, cx - x, cy - y) = color;
+    *pixelAt(p_gfx2d, cx + y, cy + x) = color;
+    *pixelAt(p_gfx2d, cx - y, cy + x) = color;
+    *pixelAt(p_gfx2d, cx + y, cy - x) = color;
+    *pixelAt(p_gfx2d, cx - y, cy - x) = color;
+
+    return;
+  }
+
+  drawGfx2dPixel(p_gfx2d, cx + x, cy + y, color);
+  drawGfx2dPixel(p_gfx2d, cx - x, cy + y, color);
+  drawGfx2dPixel(p_gfx2d, cx + x, cy - y, color);
+  drawGfx2dPixel(p_gfx2d, cx - x, cy - y, color);
+  drawGfx2dPixel(p_gfx2d, cx + y, cy + x, color);
+  drawGfx2dPixel(p_gfx2d, cx - y, cy + x, color);
+  drawGfx2dPixel(p_gfx2d, cx + y, cy - x, color);
+  drawGfx2dPixel(p_gfx2d, cx - y, cy - x, color);
+}
+
+// Initializes a surface
+int initGfx2d(struct s_gfx2d *p_gfx2d, uint32_t vmem_addr, uint32_t stride, uint32_t width, uint32_t height)
+{
+  if(!p_gfx2d) return 1;
+
+  if(!vmem_addr || !width || !height || (stride < width)) return 1;
+
+  p_gfx2d->p_pixels = (uint32_t *)vmem_addr;
+  p_gfx2d->stride   = stride;
+  p_gfx2d->width    = (int32_t)width;
+  p_gfx2d->height   = (int32_t)height;
+
+  clrGfx2dClip(p_gfx2d);
+
+  return 0;
+}
+
+// set the clip rectangle
+void setGfx2dClip(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if(!p_gfx2d) return;
+
+  clrGfx2dClip(p_gfx2d);
+
+  // nothing left draws nothing, an empty clip at the origin.
+  if(!clipRect(p_gfx2d, &x, &y, &w, &h, NULL, NULL))
+  {
+    x = 0;
+    y = 0;
+    w = 0;
+    h = 0;
+  }
+
+  p_gfx2d->clip_x0 = x;
+  p_gfx2d->clip_y0 = y;
+  p_gfx2d->clip_x1 = x + w;
+  p_gfx2d->clip_y1 = y + h;
+}
+
+// clip to the whole surface
+void clrGfx2dClip(struct s_gfx2d *p_gfx2d)
+{
+  if(!p_gfx2d) return;
+
+  p_gfx2d->clip_x0 = 0;
+  p_gfx2d->clip_y0 = 0;
+  p_gfx2d->clip_x1 = p_gfx2d->width;
+  p_gfx2d->clip_y1 = p_gfx2d->height;
+}
+
+// draw one pixel
+void drawGfx2dPixel(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, uint32_t color)
+{
+  if(!p_gfx2d) return;
+
+  if(outCode(p_gfx2d, x, y)) return;
+
+  *pixelAt(p_gfx2d, x, y) = color;
+}
+
+// draw a line with Bresenham
+void drawGfx2dLine(struct s_gfx2d *p_gfx2d, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
+{
+  int steep = 0;
+
+  int32_t step_x = 0;
+  int32_t step_y = 0;
+  int32_t step_major = 0;
+  int32_t step_minor = 0;
+
+  int64_t major = 0;
+  int64_t minor = 0;
+  int64_t first = 0;
+  int64_t last = 0;
+  int64_t err = 0;
+  int64_t lo = 0;
+  int64_t hi = 0;
+
+  uint32_t *p_dst = NULL;
+
+  if(!p_gfx2d) return;
+
+  if(y0 == y1)
+  {
+    fillGfx2dRect(p_gfx2d, (x0 < x1 ? x0 : x1), y0, abs(x1 - x0) + 1, 1, color);
+
+    return;
+  }
+
+  if(x0 == x1)
+  {
+    fillGfx2dRect(p_gfx2d, x0, (y0 < y1 ? y0 : y1), 1, abs(y1 - y0) + 1, color);
+
+    return;
+  }
+
+  step_x = (x0 < x1 ? 1 : -1);
+  step_y = (y0 < y1 ? 1 : -1);
+
+  steep = (abs(y1 - y0) > abs(x1 - x0));
+
+  /*
+   * step t moves the major axis t pixels and the minor axis
+   * floor((2 * t * minor + major) / (2 * major)). Both only grow with t,
+   * so the steps inside the clip are one range worked out up front and the
+   * loop starts at the first of them without checking a pixel.
+   */
+  if(!steep)
+  {
+    major = abs(x1 - x0);
+    minor = abs(y1 - y0);
+
+    first = (step_x > 0 ? p_gfx2d->clip_x0 - x0 : x0 - (p_gfx2d->clip_x1 - 1));
+    last  = (step_x > 0 ? p_gfx2d->clip_x1 - 1 - x0 : x0 - p_gfx2d->clip_x0);
+
+    lo = (step_y > 0 ? p_gfx2d->clip_y0 - y0 : y0 - (p_gfx2d->clip_y1 - 1));
+    hi = (step_y > 0 ? p_gfx2d->clip_y1 - 1 - y0 : y0 - p_gfx2d->clip_y0);
+
+    step_major = step_x;
+    step_minor = step_y * (int32_t)p_gfx2d->stride;
+  }
+  else
+  {
+    major = abs(y1 - y0);
+    minor = abs(x1 - x0);
+
+    first = (step_y > 0 ? p_gfx2d->clip_y0 - y0 : y0 - (p_gfx2d->clip_y1 - 1));
+    last  = (step_y > 0 ? p_gfx2d->clip_y1 - 1 - y0 : y0 - p_gfx2d->clip_y0);
+
+    lo = (step_x > 0 ? p_gfx2d->clip_x0 - x0 : x0 - (p_gfx2d->clip_x1 - 1));
+    hi = (step_x > 0 ? p_gfx2d->clip_x1 - 1 - x0 : x0 - p_gfx2d->clip_x0);
+
+    step_major = step_y * (int32_t)p_gfx2d->stride;
+    step_minor = step_x;
+  }
+
+  // cut to the line, then to the steps whose minor axis lands between lo and hi.
+  if(first < 0) first = 0;
+  if(last > major) last = major;
+
+  if(first < ceilDiv(2 * major * lo - major, 2 * minor)) first = ceilDiv(2 * major * lo - major, 2 * minor);
+  if(last > floorDiv(2 * major * (hi + 1) - major - 1, 2 * minor)) last = floorDiv(2 * major * (hi + 1) - major - 1, 2 * minor);
+
+  if(first > last) return;
+
+  err = 2 * first * minor + major;
+
+  if(!steep)
+  {
+    p_dst = pixelAt(p_gfx2d, x0 + step_x * (int32_t)first, y0 + step_y * (int32_t)(err / (2 * major)));
+  }
+  else
+  {
+    p_dst = pixelAt(p_gfx2d, x0 + step_x * (int32_t)(err / (2 * major)), y0 + step_y * (int32_t)first);
+  }
+
+  err %= 2 * major;
+
+  for(;;)
+  {
+    *p_dst = color;
+
+    if(first++ == last) break;
+
+    p_dst += step_major;
+
+    err += 2 * minor;
+
+    if(err >= 2 * major)
+    {
+      err -= 2 * major;
+      p_dst += step_minor;
+    }
+  }
+}
+
+// draw a rectangle outline
+void drawGfx2dRect(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  if(!p_gfx2d) return;
+
+  if((w <= 0) || (h <= 0)) return;
+
+  fillGfx2dRect(p_gfx2d, x, y, w, 1, color);
+
+  if(h == 1) return;
+
+  fillGfx2dRect(p_gfx2d, x, y + h - 1, w, 1, color);
+
+  if(h == 2) return;
+
+  fillGfx2dRect(p_gfx2d, x, y + 1, 1, h - 2, color);
+
+  if(w == 1) return;
+
+  fillGfx2dRect(p_gfx2d, x + w - 1, y + 1, 1, h - 2, color);
+}
+
+// fill a rectangle
+void fillGfx2dRect(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  uint32_t *p_dst = NULL;
+
+  if(!p_gfx2d) return;
+
+  if(!clipRect(p_gfx2d, &x, &y, &w, &h, NULL, NULL)) return;
+
+  p_dst = pixelAt(p_gfx2d, x, y);
+
+  for(; h > 0; h--, p_dst += p_gfx2d->stride) fillSpan(p_dst, (uint32_t)w, color);
+}
+
+// blend a color over a rectangle
+void blendGfx2dRect(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color, uint8_t alpha)
+{
+  uint32_t inv = 0;
+  uint32_t src_rb = 0;
+  uint32_t src_g = 0;
+
+  uint32_t *p_dst = NULL;
+
+  if(!p_gfx2d) return;
+
+  if(!alpha) return;
+
+  if(alpha == 255)
+  {
+    fillGfx2dRect(p_gfx2d, x, y, w, h, color);
+
+    return;
+  }
+
+  if(!clipRect(p_gfx2d, &x, &y, &w, &h, NULL, NULL)) return;
+
+  // the color side of the blend is the same for every pixel.
+  inv    = 256 - scaleAlpha(alpha);
+  src_rb = (color & RB_MASK) * scaleAlpha(alpha);
+  src_g  = (color & G_MASK)  * scaleAlpha(alpha);
+
+  p_dst = pixelAt(p_gfx2d, x, y);
+
+  for(; h > 0; h--, p_dst += p_gfx2d->stride)
+  {
+    for(int32_t index = 0; index < w; index++)
+    {
+      uint32_t dst = p_dst[index];
+
+      uint32_t rb = ((dst & RB_MASK) * inv + src_rb) >> 8;
+      uint32_t g  = ((dst & G_MASK)  * inv + src_g)  >> 8;
+
+      p_dst[index] = (rb & RB_MASK) | (g & G_MASK) | (dst & A_MASK);
+    }
+  }
+}
+
+// draw a circle outline
+void drawGfx2dCircle(struct s_gfx2d *p_gfx2d, int32_t cx, int32_t cy, int32_t r, uint32_t color)
+{
+  int inside = 0;
+
+  int32_t x = r;
+  int32_t y = 0;
+  int32_t err = 1 - r;
+
+  if(!p_gfx2d) return;
+
+  if(r < 0) return;
+
+  // clip the bounding box once, the points only need checking when the circle crosses the clip.
+  if((cx + r < p_gfx2d->clip_x0) || (cx - r >= p_gfx2d->clip_x1) || (cy + r < p_gfx2d->clip_y0) || (cy - r >= p_gfx2d->clip_y1)) return;
+
+  inside = !outCode(p_gfx2d, cx - r, cy - r) && !outCode(p_gfx2d, cx + r, cy + r);
+
+  while(x >= y)
+  {
+    plotCircle(p_gfx2d, cx, cy, x, y, color, inside);
+
+    y++;
+
+    if(err < 0)
+    {
+      err += 2 * y + 1;
+    }
+    else
+    {
+      x--;
+      err += 2 * (y - x) + 1;
+    }
+  }
+}
+
+// fill a circle
+void fillGfx2dCircle(struct s_gfx2d *p_gfx2d, int32_t cx, int32_t cy, int32_t r, uint32_t color)
+{
+  int32_t x = r;
+  int32_t y = 0;
+  int32_t err = 1 - r;
+
+  if(!p_gfx2d) return;
+
+  if(r < 0) return;
+
+  if((cx + r < p_gfx2d->clip_x0) || (cx - r >= p_gfx2d->clip_x1) || (cy + r < p_gfx2d->clip_y0) || (cy - r >= p_gfx2d->clip_y1)) return;
+
+  while(x >= y)
+  {
+    // rows cy +- y, each drawn once.
+    fillGfx2dRect(p_gfx2d, cx - x, cy + y, 2 * x + 1, 1, color);
+
+    if(y) fillGfx2dRect(p_gfx2d, cx - x, cy - y, 2 * x + 1, 1, color);
+
+    y++;
+
+    if(err < 0)
+    {
+      err += 2 * y + 1;
+    }
+    else
+    {
+      // rows cy +- x are final once x moves on, unless the other half already drew them.
+      if(x >= y)
+      {
+        fillGfx2dRect(p_gfx2d, cx - y + 1, cy + x, 2 * y - 1, 1, color);
+        fillGfx2dRect(p_gfx2d, cx - y + 1, cy - x, 2 * y - 1, 1, color);
+      }
+
+      x--;
+      err += 2 * (y - x) + 1;
+    }
+  }
+}
+
+// copy an image
+void blitGfx2d(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h, const uint32_t *p_src, uint32_t src_stride)
+{
+  int32_t src_x = 0;
+  int32_t src_y = 0;
+
+  uint32_t *p_dst = NULL;
+
+  if(!p_gfx2d || !p_src) return;
+
+  if(!clipRect(p_gfx2d, &x, &y, &w, &h, &src_x, &src_y)) return;
+
+  p_dst = pixelAt(p_gfx2d, x, y);
+  p_src += (uint32_t)src_y * src_stride + (uint32_t)src_x;
+
+  for(; h > 0; h--, p_dst += p_gfx2d->stride, p_src += src_stride) copySpan(p_dst, p_src, (uint32_t)w);
+}
+
+// copy an image, skipping the color key
+void blitGfx2dKey(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h, const uint32_t *p_src, uint32_t src_stride, uint32_t key)
+{
+  int32_t src_x = 0;
+  int32_t src_y = 0;
+
+  uint32_t *p_dst = NULL;
+
+  if(!p_gfx2d || !p_src) return;
+
+  if(!clipRect(p_gfx2d, &x, &y, &w, &h, &src_x, &src_y)) return;
+
+  p_dst = pixelAt(p_gfx2d, x, y);
+  p_src += (uint32_t)src_y * src_stride + (uint32_t)src_x;
+
+  for(; h > 0; h--, p_dst += p_gfx2d->stride, p_src += src_stride)
+  {
+    for(int32_t index = 0; index < w; index++)
+    {
+      uint32_t src = p_src[index];
+
+      if((src ^ key) & GFX2D_RGB_MASK) p_dst[index] = src;
+    }
+  }
+}
+
+// blend an image over the surface
+void blendGfx2d(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h, const uint32_t *p_src, uint32_t src_stride, uint32_t alpha)
+{
+  int32_t src_x = 0;
+  int32_t src_y = 0;
+
+  uint32_t *p_dst = NULL;
+
+  if(!p_gfx2d || !p_src) return;
+
+  if(!alpha) return;
+
+  if(alpha == 255)
+  {
+    blitGfx2d(p_gfx2d, x, y, w, h, p_src, src_stride);
+
+    return;
+  }
+
+  if(!clipRect(p_gfx2d, &x, &y, &w, &h, &src_x, &src_y)) return;
+
+  p_dst = pixelAt(p_gfx2d, x, y);
+  p_src += (uint32_t)src_y * src_stride + (uint32_t)src_x;
+
+  if(alpha != GFX2D_ALPHA_PIXEL)
+  {
+    alpha = scaleAlpha(alpha & 0xFF);
+
+    for(; h > 0; h--, p_dst += p_gfx2d->stride, p_src += src_stride)
+    {
+      for(int32_t index = 0; index < w; index++) p_dst[index] = blendPixel(p_dst[index], p_src[index], alpha);
+    }
+
+    return;
+  }
+
+  for(; h > 0; h--, p_dst += p_gfx2d->stride, p_src += src_stride)
+  {
+    for(int32_t index = 0; index < w; index++)
+    {
+      uint32_t src = p_src[index];
+      uint32_t src_alpha = src >> 24;
+
+      // sprites are mostly clear or solid, neither needs the multiplies.
+      if(src_alpha == 255) p_dst[index] = src;
+      else if(src_alpha) p_dst[index] = blendPixel(p_dst[index], src, scaleAlpha(src_alpha));
+    }
+  }
+}
@@ -0,0 +1,274 @@
+/***************************************************************************//**
+  * @file     gfx2d.h
+  * @brief    2D drawing primitives
+  * @details  Lines, rects, circles and clipped, color keyed and alpha blended blits on a8r8g8b8 surfaces.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __GFX2D_H
+#define __GFX2D_H
+
+#include <stdint.h>
+
+#include <axi_tft.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def GFX2D_RGB_MASK
+ * bits compared against a color key, the alpha byte is ignored.
+ */
+#define GFX2D_RGB_MASK  0x00FFFFFF
+
+/**
+ * @def GFX2D_ALPHA_PIXEL
+ * blendGfx2d alpha that takes each source pixel's own alpha byte.
+ */
+#define GFX2D_ALPHA_PIXEL 0x100
+
+/**
+ * @struct s_gfx2d
+ * @brief a8r8g8b8 surface to draw on and the clip rectangle every primitive is cut to.
+ */
+struct s_gfx2d
+{
+  /**
+   * @var s_gfx2d::p_pixels
+   * first pixel of the surface.
+   */
+  uint32_t *p_pixels;
+  /**
+   * @var s_gfx2d::stride
+   * pixels between rows, XRES_VIR for a framebuffer.
+   */
+  uint32_t stride;
+  /**
+   * @var s_gfx2d::width
+   * surface width in pixels.
+   */
+  int32_t width;
+  /**
+   * @var s_gfx2d::height
+   * surface height in pixels.
+   */
+  int32_t height;
+  /**
+   * @var s_gfx2d::clip_x0
+   * leftmost column drawn.
+   */
+  int32_t clip_x0;
+  /**
+   * @var s_gfx2d::clip_y0
+   * top row drawn.
+   */
+  int32_t clip_y0;
+  /**
+   * @var s_gfx2d::clip_x1
+   * one past the rightmost column drawn.
+   */
+  int32_t clip_x1;
+  /**
+   * @var s_gfx2d::clip_y1
+   * one past the bottom row drawn.
+   */
+  int32_t clip_y1;
+};
+
+/*********************************************//**
+  * @brief Initializes a surface, clipped to all of it.
+  *
+  * @param p_gfx2d surface to init
+  * @param vmem_addr first pixel, a framebuffer base
+  * address or a buffer in memory.
+  * @param stride pixels between rows, XRES_VIR for a
+  * framebuffer.
+  * @param width surface width in pixels, XRES for a
+  * framebuffer.
+  * @param height surface height in pixels, YRES for a
+  * framebuffer.
+  *
+  * @return 0 on success, 1 on bad arguments.
+  *************************************************/
+int initGfx2d(struct s_gfx2d *p_gfx2d, uint32_t vmem_addr, uint32_t stride, uint32_t width, uint32_t height);
+
+/*********************************************//**
+  * @brief set the clip rectangle, cut to the surface.
+  *
+  * @param p_gfx2d surface
+  * @param x left column
+  * @param y top row
+  * @param w width in pixels
+  * @param h height in pixels
+  *************************************************/
+void setGfx2dClip(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h);
+
+/*********************************************//**
+  * @brief clip to the whole surface again.
+  *
+  * @param p_gfx2d surface
+  *************************************************/
+void clrGfx2dClip(struct s_gfx2d *p_gfx2d);
+
+/*********************************************//**
+  * @brief draw one pixel.
+  *
+  * @param p_gfx2d surface
+  * @param x column
+  * @param y row
+  * @param color a8r8g8b8 color
+  *************************************************/
+void drawGfx2dPixel(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, uint32_t color);
+
+/*********************************************//**
+  * @brief draw a line with Bresenham, both ends
+  * included. The line is clipped before it is
+  * drawn, horizontal and vertical lines are fills.
+  *
+  * @param p_gfx2d surface
+  * @param x0 start column
+  * @param y0 start row
+  * @param x1 end column
+  * @param y1 end row
+  * @param color a8r8g8b8 color
+  *************************************************/
+void drawGfx2dLine(struct s_gfx2d *p_gfx2d, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+
+/*********************************************//**
+  * @brief draw a one pixel rectangle outline.
+  *
+  * @param p_gfx2d surface
+  * @param x left column
+  * @param y top row
+  * @param w width in pixels
+  * @param h height in pixels
+  * @param color a8r8g8b8 color
+  *************************************************/
+void drawGfx2dRect(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+
+/*********************************************//**
+  * @brief fill a rectangle.
+  *
+  * @param p_gfx2d surface
+  * @param x left column
+  * @param y top row
+  * @param w width in pixels
+  * @param h height in pixels
+  * @param color a8r8g8b8 color
+  *************************************************/
+void fillGfx2dRect(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+
+/*********************************************//**
+  * @brief blend a color over a rectangle.
+  *
+  * @param p_gfx2d surface
+  * @param x left column
+  * @param y top row
+  * @param w width in pixels
+  * @param h height in pixels
+  * @param color a8r8g8b8 color, its alpha byte is
+  * ignored.
+  * @param alpha 0 leaves the surface, 255 is a fill.
+  *************************************************/
+void blendGfx2dRect(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color, uint8_t alpha);
+
+/*********************************************//**
+  * @brief draw a one pixel circle outline with the
+  * midpoint algorithm.
+  *
+  * @param p_gfx2d surface
+  * @param cx center column
+  * @param cy center row
+  * @param r radius in pixels
+  * @param color a8r8g8b8 color
+  *************************************************/
+void drawGfx2dCircle(struct s_gfx2d *p_gfx2d, int32_t cx, int32_t cy, int32_t r, uint32_t color);
+
+/*********************************************//**
+  * @brief fill a circle, one span per row.
+  *
+  * @param p_gfx2d surface
+  * @param cx center column
+  * @param cy center row
+  * @param r radius in pixels
+  * @param color a8r8g8b8 color
+  *************************************************/
+void fillGfx2dCircle(struct s_gfx2d *p_gfx2d, int32_t cx, int32_t cy, int32_t r, uint32_t color);
+
+/*********************************************//**
+  * @brief copy a w x h image, clipped.
+  *
+  * @param p_gfx2d surface
+  * @param x left column on the surface
+  * @param y top row on the surface
+  * @param w image width
+  * @param h image height
+  * @param p_src a8r8g8b8 image
+  * @param src_stride pixels between image rows.
+  *************************************************/
+void blitGfx2d(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h, const uint32_t *p_src, uint32_t src_stride);
+
+/*********************************************//**
+  * @brief copy a w x h image, clipped, skipping the
+  * pixels that match a color key.
+  *
+  * @param p_gfx2d surface
+  * @param x left column on the surface
+  * @param y top row on the surface
+  * @param w image width
+  * @param h image height
+  * @param p_src a8r8g8b8 image
+  * @param src_stride pixels between image rows.
+  * @param key color left transparent, compared with
+  * GFX2D_RGB_MASK.
+  *************************************************/
+void blitGfx2dKey(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h, const uint32_t *p_src, uint32_t src_stride, uint32_t key);
+
+/*********************************************//**
+  * @brief blend a w x h image over the surface,
+  * clipped.
+  *
+  * @param p_gfx2d surface
+  * @param x left column on the surface
+  * @param y top row on the surface
+  * @param w image width
+  * @param h image height
+  * @param p_src a8r8g8b8 image
+  * @param src_stride pixels between image rows.
+  * @param alpha 0 to 255 for the whole image, or
+  * GFX2D_ALPHA_PIXEL for each pixel's own alpha byte.
+  *************************************************/
+void blendGfx2d(struct s_gfx2d *p_gfx2d, int32_t x, int32_t y, int32_t w, int32_t h, const uint32_t *p_src, uint32_t src_stride, uint32_t alpha);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
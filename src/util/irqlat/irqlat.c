@@ -0,0 +1,242 @@
+/***************************************************************************//**
+  * @file     irqlat.c
+  * @brief    Interrupt latency measurement
+  * @details  Trigger CLINT software or timer interrupts at known times and collect entry latency in cycles.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <riscv-csr.h>
+
+#include "irqlat.h"
+
+static struct
+{
+  struct s_clint *p_clint;
+  uint32_t *p_samples;
+  uint32_t max_samples;
+  uint32_t cycles_per_tick;
+  volatile uint32_t count;
+  volatile uint32_t trigger;
+  uint64_t deadline;
+  uint64_t period;
+} g_irqlat;
+
+// low 32 bits of mcycle, latencies are differences.
+static inline uint32_t readCycles(void)
+{
+  return (uint32_t)csr_read_mcycle();
+}
+
+// store a sample if there is room
+static inline void addSample(uint32_t latency)
+{
+  if(g_irqlat.count >= g_irqlat.max_samples) return;
+
+  g_irqlat.p_samples[g_irqlat.count] = latency;
+
+  g_irqlat.count++;
+}
+
+// qsort compare
+static int cmpSample(const void *p_a, const void *p_b)
+{
+  uint32_t a = *(const uint32_t *)p_a;
+  uint32_t b = *(const uint32_t *)p_b;
+
+  return (a > b) - (a < b);
+}
+
+// Initializes the latency harness
+int initIrqLat(struct s_clint *p_clint, uint32_t max_samples, uint32_t cycles_per_tick)
+{
+  if(!p_clint) return 1;
+
+  if(!max_samples) return 1;
+
+  freeIrqLat();
+
+  memset(&g_irqlat, 0, sizeof(g_irqlat));
+
+  g_irqlat.p_samples = malloc(max_samples * sizeof(uint32_t));
+
+  if(!g_irqlat.p_samples) return 1;
+
+  g_irqlat.p_clint         = p_clint;
+  g_irqlat.max_samples     = max_samples;
+  g_irqlat.cycles_per_tick = (cycles_per_tick ? cycles_per_tick : 1);
+
+  return 0;
+}
+
+// free the sample buffer
+void freeIrqLat(void)
+{
+  free(g_irqlat.p_samples);
+
+  g_irqlat.p_samples = NULL;
+  g_irqlat.max_samples = 0;
+  g_irqlat.count = 0;
+}
+
+// measure trap entry cost with msip
+uint32_t runIrqLatMsi(uint32_t samples)
+{
+  uint32_t index;
+  uint32_t count;
+
+  if(!g_irqlat.p_clint) return 0;
+
+  // nothing would ever take the interrupt.
+  if(!(csr_read_mstatus() & MSTATUS_MIE_BIT_MASK) || !(csr_read_mie() & MIE_MSI_BIT_MASK)) return 0;
+
+  for(index = 0; index < samples; index++)
+  {
+    if(g_irqlat.count >= g_irqlat.max_samples) break;
+
+    count = g_irqlat.count;
+
+    g_irqlat.trigger = readCycles();
+
+    setClintMsip(g_irqlat.p_clint);
+
+    // taken right after the store unless something has interrupts masked.
+    while(g_irqlat.count == count);
+  }
+
+  return index;
+}
+
+// start timer interrupts at known mtime stamps
+void startIrqLatMti(uint64_t period)
+{
+  if(!g_irqlat.p_clint) return;
+
+  g_irqlat.period   = (period ? period : 1);
+  g_irqlat.deadline = getClintMTime(g_irqlat.p_clint) + g_irqlat.period;
+
+  setClintMTimeCmp(g_irqlat.p_clint, g_irqlat.deadline);
+}
+
+// stop timer interrupts
+void stopIrqLatMti(void)
+{
+  if(!g_irqlat.p_clint) return;
+
+  g_irqlat.period = 0;
+
+  setClintMTimeCmp(g_irqlat.p_clint, ~(uint64_t)0);
+}
+
+// check if the sample buffer is full
+int isIrqLatFull(void)
+{
+  return (g_irqlat.count >= g_irqlat.max_samples);
+}
+
+// record a software interrupt sample
+void irqLatMsiHandler(void)
+{
+  uint32_t entry = readCycles();
+
+  clrClintMsip(g_irqlat.p_clint);
+
+  addSample(entry - g_irqlat.trigger);
+}
+
+// record a timer interrupt sample and arm the next one
+void irqLatMtiHandler(void)
+{
+  uint64_t mtime = getClintMTime(g_irqlat.p_clint);
+
+  addSample((uint32_t)(mtime - g_irqlat.deadline) * g_irqlat.cycles_per_tick);
+
+  if(!g_irqlat.period || isIrqLatFull())
+  {
+    setClintMTimeCmp(g_irqlat.p_clint, ~(uint64_t)0);
+    return;
+  }
+
+  // keep to the stamp grid, skip stamps that were missed entirely.
+  g_irqlat.deadline += g_irqlat.period;
+
+  if(g_irqlat.deadline <= mtime) g_irqlat.deadline = mtime + g_irqlat.period;
+
+  setClintMTimeCmp(g_irqlat.p_clint, g_irqlat.deadline);
+}
+
+// sort the samples and summarize them
+void getIrqLatStats(struct s_irqlat_stats *p_stats)
+{
+  uint32_t index;
+  uint32_t count = g_irqlat.count;
+  uint64_t sum = 0;
+
+  if(!p_stats) return;
+
+  memset(p_stats, 0, sizeof(struct s_irqlat_stats));
+
+  if(!count) return;
+
+  qsort(g_irqlat.p_samples, count, sizeof(uint32_t), cmpSample);
+
+  for(index = 0; index < count; index++)
+  {
+    sum += g_irqlat.p_samples[index];
+  }
+
+  p_stats->count = count;
+  p_stats->min   = g_irqlat.p_samples[0];
+  p_stats->max   = g_irqlat.p_samples[count-1];
+  p_stats->avg   = (uint32_t)(sum / count);
+  p_stats->p50   = g_irqlat.p_samples[(count * 50) / 100];
+  p_stats->p90   = g_irqlat.p_samples[(count * 90) / 100];
+  p_stats->p99   = g_irqlat.p_samples[(count * 99) / 100];
+
+  g_irqlat.count = 0;
+}
+
+// print a summary
+void printIrqLatStats(const char *p_name, struct s_irqlat_stats *p_stats)
+{
+  if(!p_stats) return;
+
+  printf("\n\r%-12s n=%lu min=%lu avg=%lu p50=%lu p90=%lu p99=%lu max=%lu cycles\n\r",
+         (p_name ? p_name : "irqlat"),
+         (unsigned long)p_stats->count,
+         (unsigned long)p_stats->min,
+         (unsigned long)p_stats->avg,
+         (unsigned long)p_stats->p50,
+         (unsigned long)p_stats->p90,
+         (unsigned long)p_stats->p99,
+         (unsigned long)p_stats->max);
+}
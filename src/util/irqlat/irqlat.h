@@ -0,0 +1,167 @@
+/***************************************************************************//**
+  * @file     irqlat.h
+  * @brief    Interrupt latency measurement
+  * @details  Trigger CLINT software or timer interrupts at known times and collect entry latency in cycles.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __IRQLAT_H
+#define __IRQLAT_H
+
+#include <stdint.h>
+
+#include <clint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct s_irqlat_stats
+ * @brief latency summary in cpu cycles
+ */
+struct s_irqlat_stats
+{
+  /**
+  * @var s_irqlat_stats::count
+  * number of samples
+  */
+  uint32_t count;
+  /**
+  * @var s_irqlat_stats::min
+  * smallest latency
+  */
+  uint32_t min;
+  /**
+  * @var s_irqlat_stats::max
+  * largest latency
+  */
+  uint32_t max;
+  /**
+  * @var s_irqlat_stats::avg
+  * mean latency
+  */
+  uint32_t avg;
+  /**
+  * @var s_irqlat_stats::p50
+  * median latency
+  */
+  uint32_t p50;
+  /**
+  * @var s_irqlat_stats::p90
+  * 90th percentile latency
+  */
+  uint32_t p90;
+  /**
+  * @var s_irqlat_stats::p99
+  * 99th percentile latency
+  */
+  uint32_t p99;
+};
+
+/*********************************************//**
+  * @brief Initializes the latency harness.
+  *
+  * @param p_clint pre-initialized struct from initClint
+  * @param max_samples samples to keep, allocated here.
+  * @param cycles_per_tick cpu cycles per mtime tick (CPU_FREQ_HZ/BUS_FREQ_HZ)
+  *
+  * @return 0 on success, 1 if out of memory.
+  *************************************************/
+int initIrqLat(struct s_clint *p_clint, uint32_t max_samples, uint32_t cycles_per_tick);
+
+/*********************************************//**
+  * @brief free the sample buffer.
+  *************************************************/
+void freeIrqLat(void);
+
+/*********************************************//**
+  * @brief measure trap entry cost, raise msip and wait
+  * for the handler, samples times. Needs MIE and MSIE on.
+  *
+  * @param samples number of interrupts to take
+  *
+  * @return number of samples taken.
+  *************************************************/
+uint32_t runIrqLatMsi(uint32_t samples);
+
+/*********************************************//**
+  * @brief start timer interrupts at known mtime stamps,
+  * latency includes any time interrupts were masked.
+  * Run a workload, then call stopIrqLatMti.
+  *
+  * @param period mtime ticks between interrupts
+  *************************************************/
+void startIrqLatMti(uint64_t period);
+
+/*********************************************//**
+  * @brief stop timer interrupts from startIrqLatMti.
+  *************************************************/
+void stopIrqLatMti(void);
+
+/*********************************************//**
+  * @brief check if the sample buffer is full.
+  *
+  * @return 1 if full, 0 if not.
+  *************************************************/
+int isIrqLatFull(void);
+
+/*********************************************//**
+  * @brief record a software interrupt sample, must be
+  * the first thing called from riscv_mtvec_msi.
+  *************************************************/
+void irqLatMsiHandler(void);
+
+/*********************************************//**
+  * @brief record a timer interrupt sample and arm the
+  * next one, must be the first thing called from riscv_mtvec_mti.
+  *************************************************/
+void irqLatMtiHandler(void);
+
+/*********************************************//**
+  * @brief sort the samples and summarize them, then
+  * clear them for the next run.
+  *
+  * @param p_stats storage for the summary
+  *************************************************/
+void getIrqLatStats(struct s_irqlat_stats *p_stats);
+
+/*********************************************//**
+  * @brief print a summary with printf.
+  *
+  * @param p_name name of the run
+  * @param p_stats summary from getIrqLatStats
+  *************************************************/
+void printIrqLatStats(const char *p_name, struct s_irqlat_stats *p_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,363 @@
+/***************************************************************************//**
+  * @file     pcsamp.c
+  * @brief    Statistical pc sampling profiler
+  * @details  Sample mepc (and optionally ra) from a CLINT timer interrupt into a histogram over the code range.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <riscv-csr.h>
+
+#include "pcsamp.h"
+
+#ifdef PCSAMP_FATFS
+#include <pff3a/pff.h>
+#endif
+
+// linker script code range
+extern char __text_start[];
+extern char __text_end[];
+
+/**
+ * @struct s_pcsamp_edge
+ * @brief call graph slot
+ */
+struct s_pcsamp_edge
+{
+  uint32_t pc;
+  uint32_t ra;
+  uint32_t count;
+};
+
+static struct
+{
+  struct s_clint *p_clint;
+  uint16_t *p_hist;
+  struct s_pcsamp_edge *p_edges;
+  uint32_t start;
+  uint32_t size;
+  uint32_t shift;
+  uint32_t bins;
+  uint32_t edge_mask;
+  uint64_t period;
+  uint64_t deadline;
+  uint32_t dither;
+  uint32_t random;
+  struct s_pcsamp_stats stats;
+} g_pcsamp;
+
+// add a pc/ra pair to the call graph table
+static void addEdge(uint32_t pc, uint32_t ra)
+{
+  uint32_t index;
+  uint32_t hash;
+
+  struct s_pcsamp_edge *p_edge = NULL;
+
+  hash = ((pc >> 1) * 2654435761u) ^ (ra >> 1);
+
+  for(index = 0; index < PCSAMP_EDGE_PROBES; index++)
+  {
+    p_edge = &g_pcsamp.p_edges[(hash + index) & g_pcsamp.edge_mask];
+
+    if(!p_edge->count)
+    {
+      p_edge->pc = pc;
+      p_edge->ra = ra;
+    }
+
+    if((p_edge->pc == pc) && (p_edge->ra == ra))
+    {
+      p_edge->count++;
+      return;
+    }
+  }
+
+  g_pcsamp.stats.dropped++;
+}
+
+// arm mtimecmp for the next sample
+static void armNext(uint64_t mtime)
+{
+  uint64_t period = g_pcsamp.period;
+
+  if(g_pcsamp.dither)
+  {
+    // xorshift32
+    g_pcsamp.random ^= g_pcsamp.random << 13;
+    g_pcsamp.random ^= g_pcsamp.random >> 17;
+    g_pcsamp.random ^= g_pcsamp.random << 5;
+
+    period += g_pcsamp.random & g_pcsamp.dither;
+  }
+
+  g_pcsamp.deadline += period;
+
+  // never schedule in the past, a long masked section would storm.
+  if(g_pcsamp.deadline <= mtime) g_pcsamp.deadline = mtime + period;
+
+  setClintMTimeCmp(g_pcsamp.p_clint, g_pcsamp.deadline);
+}
+
+// Initializes the profiler and allocates the histogram
+int initPcSamp(struct s_clint *p_clint, uint32_t shift, uint32_t edges)
+{
+  uint32_t slots = 1;
+
+  if(!p_clint) return 1;
+
+  if(shift > 16) return 1;
+
+  freePcSamp();
+
+  memset(&g_pcsamp, 0, sizeof(g_pcsamp));
+
+  g_pcsamp.start = (uint32_t)__text_start;
+  g_pcsamp.size  = (uint32_t)(__text_end - __text_start);
+  g_pcsamp.shift = shift;
+  g_pcsamp.bins  = (g_pcsamp.size + (1u << shift) - 1) >> shift;
+
+  g_pcsamp.p_hist = calloc(g_pcsamp.bins, sizeof(uint16_t));
+
+  if(!g_pcsamp.p_hist) return 1;
+
+  if(edges)
+  {
+    while(slots < edges) slots <<= 1;
+
+    g_pcsamp.p_edges = calloc(slots, sizeof(struct s_pcsamp_edge));
+
+    if(!g_pcsamp.p_edges)
+    {
+      freePcSamp();
+      return 1;
+    }
+
+    g_pcsamp.edge_mask = slots - 1;
+  }
+
+  g_pcsamp.p_clint = p_clint;
+  g_pcsamp.random  = 0x2545F491;
+
+  return 0;
+}
+
+// stop sampling and free the histogram
+void freePcSamp(void)
+{
+  stopPcSamp();
+
+  free(g_pcsamp.p_hist);
+  free(g_pcsamp.p_edges);
+
+  g_pcsamp.p_hist    = NULL;
+  g_pcsamp.p_edges   = NULL;
+  g_pcsamp.bins      = 0;
+  g_pcsamp.edge_mask = 0;
+}
+
+// start sampling
+void startPcSamp(uint64_t period, uint32_t dither)
+{
+  if(!g_pcsamp.p_clint) return;
+
+  if(!g_pcsamp.p_hist) return;
+
+  g_pcsamp.period   = (period ? period : 1);
+  g_pcsamp.dither   = dither;
+  g_pcsamp.deadline = getClintMTime(g_pcsamp.p_clint);
+
+  armNext(g_pcsamp.deadline);
+}
+
+// stop sampling
+void stopPcSamp(void)
+{
+  if(!g_pcsamp.p_clint) return;
+
+  g_pcsamp.period = 0;
+
+  setClintMTimeCmp(g_pcsamp.p_clint, ~(uint64_t)0);
+}
+
+// zero the histogram, call graph and stats
+void clrPcSamp(void)
+{
+  if(g_pcsamp.p_hist) memset(g_pcsamp.p_hist, 0, g_pcsamp.bins * sizeof(uint16_t));
+
+  if(g_pcsamp.p_edges) memset(g_pcsamp.p_edges, 0, (g_pcsamp.edge_mask + 1) * sizeof(struct s_pcsamp_edge));
+
+  memset(&g_pcsamp.stats, 0, sizeof(g_pcsamp.stats));
+}
+
+// flat profile sample
+void pcSampMtiHandler(void)
+{
+  pcSampRecord(csr_read_mepc(), 0);
+}
+
+// record a sample and arm the next one
+void pcSampRecord(uint32_t pc, uint32_t ra)
+{
+  uint32_t offset = pc - g_pcsamp.start;
+
+  if(!g_pcsamp.p_clint) return;
+
+  if(!g_pcsamp.period)
+  {
+    setClintMTimeCmp(g_pcsamp.p_clint, ~(uint64_t)0);
+    return;
+  }
+
+  g_pcsamp.stats.samples++;
+
+  if(offset < g_pcsamp.size)
+  {
+    uint16_t *p_bin = &g_pcsamp.p_hist[offset >> g_pcsamp.shift];
+
+    if(*p_bin != UINT16_MAX)
+    {
+      (*p_bin)++;
+    }
+    else
+    {
+      g_pcsamp.stats.saturated++;
+    }
+  }
+  else
+  {
+    g_pcsamp.stats.outside++;
+  }
+
+  if(ra && g_pcsamp.p_edges) addEdge(pc, ra);
+
+  armNext(getClintMTime(g_pcsamp.p_clint));
+}
+
+// get the sample counts
+void getPcSampStats(struct s_pcsamp_stats *p_stats)
+{
+  if(!p_stats) return;
+
+  *p_stats = g_pcsamp.stats;
+}
+
+// write the histogram and call graph as text lines
+int dumpPcSamp(pcsamp_write write, void *p_ctx)
+{
+  int len;
+  uint32_t index;
+  char line[PCSAMP_LINE_SIZE];
+
+  if(!write) return 1;
+
+  if(!g_pcsamp.p_hist) return 1;
+
+  len = snprintf(line, sizeof(line), "PCSAMP BEGIN %08lx %08lx %lu\n\r", (unsigned long)g_pcsamp.start, (unsigned long)g_pcsamp.size, (unsigned long)g_pcsamp.shift);
+
+  if(write(p_ctx, line, len)) return 1;
+
+  len = snprintf(line, sizeof(line), "S %lu %lu %lu %lu\n\r", (unsigned long)g_pcsamp.stats.samples, (unsigned long)g_pcsamp.stats.outside, (unsigned long)g_pcsamp.stats.saturated, (unsigned long)g_pcsamp.stats.dropped);
+
+  if(write(p_ctx, line, len)) return 1;
+
+  // only bins that were hit, most of the code never is.
+  for(index = 0; index < g_pcsamp.bins; index++)
+  {
+    if(!g_pcsamp.p_hist[index]) continue;
+
+    len = snprintf(line, sizeof(line), "H %08lx %u\n\r", (unsigned long)(g_pcsamp.start + (index << g_pcsamp.shift)), g_pcsamp.p_hist[index]);
+
+    if(write(p_ctx, line, len)) return 1;
+  }
+
+  for(index = 0; g_pcsamp.p_edges && (index <= g_pcsamp.edge_mask); index++)
+  {
+    struct s_pcsamp_edge *p_edge = &g_pcsamp.p_edges[index];
+
+    if(!p_edge->count) continue;
+
+    len = snprintf(line, sizeof(line), "E %08lx %08lx %lu\n\r", (unsigned long)p_edge->pc, (unsigned long)p_edge->ra, (unsigned long)p_edge->count);
+
+    if(write(p_ctx, line, len)) return 1;
+  }
+
+  len = snprintf(line, sizeof(line), "PCSAMP END\n\r");
+
+  return write(p_ctx, line, len);
+}
+
+// stdout output for dumpPcSamp
+static int writeStdout(void *p_ctx, const char *p_buf, uint32_t len)
+{
+  (void)p_ctx;
+
+  return (fwrite(p_buf, 1, len, stdout) != len);
+}
+
+// dump over the uart
+void printPcSamp(void)
+{
+  dumpPcSamp(writeStdout, NULL);
+
+  fflush(stdout);
+}
+
+#ifdef PCSAMP_FATFS
+// petit fatfs output for dumpPcSamp
+static int writeFile(void *p_ctx, const char *p_buf, uint32_t len)
+{
+  UINT written = 0;
+
+  (void)p_ctx;
+
+  if(pf_write(p_buf, len, &written) != FR_OK) return 1;
+
+  // end of the file, it can not grow.
+  return (written != len);
+}
+
+// dump to a file on a mounted petit fatfs volume
+int writePcSampFile(const char *p_path)
+{
+  UINT written = 0;
+
+  if(!p_path) return 1;
+
+  if(pf_open(p_path) != FR_OK) return 1;
+
+  if(dumpPcSamp(writeFile, NULL)) return 1;
+
+  // flush the last sector
+  return (pf_write(NULL, 0, &written) != FR_OK);
+}
+#endif
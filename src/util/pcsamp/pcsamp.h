@@ -0,0 +1,202 @@
+/***************************************************************************//**
+  * @file     pcsamp.h
+  * @brief    Statistical pc sampling profiler
+  * @details  Sample mepc (and optionally ra) from a CLINT timer interrupt into a histogram over the code range.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __PCSAMP_H
+#define __PCSAMP_H
+
+#include <stdint.h>
+
+#include <clint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def PCSAMP_EDGE_PROBES
+ * slots searched in the call graph table before a sample is dropped.
+ */
+#define PCSAMP_EDGE_PROBES  8
+
+/**
+ * @def PCSAMP_LINE_SIZE
+ * largest line produced by dumpPcSamp.
+ */
+#define PCSAMP_LINE_SIZE    64
+
+/*********************************************//**
+  * @brief define a vector table handler that samples
+  * mepc and ra, needed for the call graph. ra is read
+  * before any compiler generated code can touch it.
+  *
+  * PCSAMP_HANDLER(riscv_mtvec_mti);
+  *
+  * @param name vector table handler (riscv_mtvec_mti)
+  *************************************************/
+#define PCSAMP_HANDLER(name) \
+  __asm__( \
+    "  .section .text." #name ", \"ax\", @progbits\n" \
+    "  .globl " #name "\n" \
+    "  .type " #name ", @function\n" \
+    "  .align 2\n" \
+    #name ":\n" \
+    "  j pcSampTrap\n" \
+    "  .size " #name ", .-" #name "\n" \
+    "  .text\n")
+
+/**
+ * @struct s_pcsamp_stats
+ * @brief sample counts
+ */
+struct s_pcsamp_stats
+{
+  /**
+  * @var s_pcsamp_stats::samples
+  * number of timer interrupts taken
+  */
+  uint32_t samples;
+  /**
+  * @var s_pcsamp_stats::outside
+  * samples with a pc outside of the code range (itim, ram)
+  */
+  uint32_t outside;
+  /**
+  * @var s_pcsamp_stats::saturated
+  * samples lost to a full histogram bin
+  */
+  uint32_t saturated;
+  /**
+  * @var s_pcsamp_stats::dropped
+  * call graph samples lost to a full edge table
+  */
+  uint32_t dropped;
+};
+
+/**
+ * @typedef pcsamp_write
+ * @brief output for dumpPcSamp, return 0 on success.
+ */
+typedef int (*pcsamp_write)(void *p_ctx, const char *p_buf, uint32_t len);
+
+/*********************************************//**
+  * @brief Initializes the profiler and allocates the histogram,
+  * one 16 bit counter per 1 << shift bytes of code.
+  *
+  * @param p_clint pointer to clint struct
+  * @param shift log2 of the bin size, 1 is one bin per compressed instruction.
+  * @param edges call graph slots, rounded up to a power of 2, 0 for a flat profile.
+  *
+  * @return 0 on success
+  *************************************************/
+int initPcSamp(struct s_clint *p_clint, uint32_t shift, uint32_t edges);
+
+/*********************************************//**
+  * @brief stop sampling and free the histogram
+  *************************************************/
+void freePcSamp(void);
+
+/*********************************************//**
+  * @brief start sampling, the profiler owns mtimecmp until stopped.
+  *
+  * @param period mtime ticks between samples
+  * @param dither mask of random ticks added to each period so
+  * the samples do not lock to a loop with the same period, 0 for none.
+  *************************************************/
+void startPcSamp(uint64_t period, uint32_t dither);
+
+/*********************************************//**
+  * @brief stop sampling
+  *************************************************/
+void stopPcSamp(void);
+
+/*********************************************//**
+  * @brief zero the histogram, call graph and stats
+  *************************************************/
+void clrPcSamp(void);
+
+/*********************************************//**
+  * @brief flat profile sample, call from riscv_mtvec_mti.
+  *************************************************/
+void pcSampMtiHandler(void);
+
+/*********************************************//**
+  * @brief record a sample and arm the next one, called by
+  * pcSampMtiHandler and the PCSAMP_HANDLER trap entry.
+  *
+  * @param pc interrupted pc (mepc)
+  * @param ra interrupted return address, 0 for none.
+  *************************************************/
+void pcSampRecord(uint32_t pc, uint32_t ra);
+
+/*********************************************//**
+  * @brief get the sample counts
+  *
+  * @param p_stats struct to fill
+  *************************************************/
+void getPcSampStats(struct s_pcsamp_stats *p_stats);
+
+/*********************************************//**
+  * @brief write the histogram and call graph as text lines,
+  * the format read by pcsamp.py.
+  *
+  * @param write output function
+  * @param p_ctx passed to write
+  *
+  * @return 0 on success
+  *************************************************/
+int dumpPcSamp(pcsamp_write write, void *p_ctx);
+
+/*********************************************//**
+  * @brief dump over the uart (stdout)
+  *************************************************/
+void printPcSamp(void);
+
+#ifdef PCSAMP_FATFS
+/*********************************************//**
+  * @brief dump to a file on a mounted petit fatfs volume.
+  * petit fatfs can not create or grow files, the file must
+  * exist and be large enough. Old data after the dump is
+  * left in place, pcsamp.py stops at the end marker.
+  *
+  * @param p_path file to overwrite
+  *
+  * @return 0 on success
+  *************************************************/
+int writePcSampFile(const char *p_path);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+################################################################################
+### date      2026.10.19
+### author    Jay Convertino
+### brief     Symbolize a pcsamp dump against the app .elf
+################################################################################
+#
+# usage
+#   pcsamp.py build/apps/pc_sample_drivers.elf uart.log
+#   pcsamp.py --lines 20 app.elf PCSAMP.TXT
+#
+# The dump is the text printPcSamp or writePcSampFile produced, other lines in
+# a captured uart log are ignored. If there are several dumps the last is used.
+
+import argparse
+import bisect
+import subprocess
+import sys
+from collections import Counter
+
+
+def read_dump(path):
+    lines = open(path, errors="replace") if path != "-" else sys.stdin
+    dump = None
+    block = None
+    for line in lines:
+        words = line.strip().split()
+        if not words:
+            continue
+        if words[0] == "PCSAMP" and len(words) > 1 and words[1] == "BEGIN":
+            block = {"start": int(words[2], 16), "size": int(words[3], 16), "shift": int(words[4]),
+                     "stats": [0, 0, 0, 0], "hist": {}, "edges": []}
+        elif block is None:
+            continue
+        elif words[0] == "PCSAMP" and len(words) > 1 and words[1] == "END":
+            dump = block
+            block = None
+        elif words[0] == "S":
+            block["stats"] = [int(word) for word in words[1:5]]
+        elif words[0] == "H":
+            block["hist"][int(words[1], 16)] = int(words[2])
+        elif words[0] == "E":
+            block["edges"].append((int(words[1], 16), int(words[2], 16), int(words[3])))
+    if dump is None:
+        sys.exit("no complete PCSAMP BEGIN/END block in " + path)
+    return dump
+
+
+class Symbols:
+    def __init__(self, nm, elf):
+        out = subprocess.run([nm, "-n", "-S", "--defined-only", elf], check=True, capture_output=True, text=True).stdout
+        self.addrs = []
+        self.syms = []
+        for line in out.splitlines():
+            words = line.split()
+            # address size type name, size is missing for asm labels
+            if len(words) == 4:
+                addr, size, kind, name = int(words[0], 16), int(words[1], 16), words[2], words[3]
+            elif len(words) == 3:
+                addr, size, kind, name = int(words[0], 16), 0, words[1], words[2]
+            else:
+                continue
+            if kind not in "tTwW":
+                continue
+            self.addrs.append(addr)
+            self.syms.append((addr, size, name))
+
+    def lookup(self, addr):
+        index = bisect.bisect_right(self.addrs, addr) - 1
+        if index < 0:
+            return "?%08x" % addr
+        start, size, name = self.syms[index]
+        if size and addr >= start + size:
+            return "?%08x" % addr
+        return name
+
+
+def addr2line(tool, elf, addrs):
+    if not addrs:
+        return {}
+    out = subprocess.run([tool, "-e", elf, "-f", "-C"] + ["%x" % addr for addr in addrs],
+                         check=True, capture_output=True, text=True).stdout.splitlines()
+    return {addr: out[2 * index + 1] for index, addr in enumerate(addrs)}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="symbolize a pcsamp histogram")
+    parser.add_argument("elf", help="app .elf the dump was taken from")
+    parser.add_argument("dump", help="uart log or sd card file, - for stdin")
+    parser.add_argument("--prefix", default="riscv-none-elf-", help="cross toolchain prefix for nm and addr2line")
+    parser.add_argument("--top", type=int, default=30, help="functions to list")
+    parser.add_argument("--lines", type=int, default=0, help="hottest bins to resolve to source lines")
+    args = parser.parse_args()
+
+    dump = read_dump(args.dump)
+    syms = Symbols(args.prefix + "nm", args.elf)
+
+    samples, outside, saturated, dropped = dump["stats"]
+    total = sum(dump["hist"].values()) or 1
+
+    print("samples %d, outside code %d, saturated %d, call graph dropped %d" % (samples, outside, saturated, dropped))
+    if outside:
+        print("  outside samples ran from ram (itim or a copied loader), they are not in the histogram")
+
+    funcs = Counter()
+    for addr, count in dump["hist"].items():
+        funcs[syms.lookup(addr)] += count
+
+    print("\n%7s %7s %8s  %s" % ("%", "cum%", "samples", "function"))
+    cumulative = 0
+    for name, count in funcs.most_common(args.top):
+        cumulative += count
+        print("%6.2f%% %6.2f%% %8d  %s" % (100.0 * count / total, 100.0 * cumulative / total, count, name))
+
+    if args.lines:
+        hot = sorted(dump["hist"].items(), key=lambda item: -item[1])[:args.lines]
+        where = addr2line(args.prefix + "addr2line", args.elf, [addr for addr, count in hot])
+        print("\n%7s %8s  %-10s %s" % ("%", "samples", "address", "line"))
+        for addr, count in hot:
+            print("%6.2f%% %8d  0x%08x %s" % (100.0 * count / total, count, addr, where[addr]))
+
+    if dump["edges"]:
+        edges = Counter()
+        for pc, ra, count in dump["edges"]:
+            callee = syms.lookup(pc)
+            # ra is the instruction after the call, step back into it.
+            caller = syms.lookup(ra - 1)
+            # a non leaf function has already reused ra, it points into itself.
+            if caller == callee:
+                continue
+            edges[(caller, callee)] += count
+        print("\n%8s  %s" % ("samples", "caller -> callee (one level, leaf functions)"))
+        for (caller, callee), count in edges.most_common(args.top):
+            print("%8d  %s -> %s" % (count, caller, callee))
+
+
+if __name__ == "__main__":
+    main()
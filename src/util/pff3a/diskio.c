@@ -56,6 +56,27 @@ DRESULT disk_readp (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Read Multiple Sectors                                                 */
+/*-----------------------------------------------------------------------*/
+
+DRESULT disk_readm (
+  BYTE* buff,		/* Pointer to the destination, count * 512 bytes */
+  DWORD sector,	/* First sector number (LBA) */
+  UINT count		/* Number of whole sectors */
+)
+{
+  DRESULT res;
+  
+  res = readSdcardSpiBlocks(&g_sdcard_spi, sector, buff, count);
+  
+  if(res) beario_stronly_printf("PFF READ ERROR: %s\n\r", getSdcardSpiStateString(&g_sdcard_spi));
+
+  return res;
+}
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Write Partial Sector                                                  */
 /*-----------------------------------------------------------------------*/
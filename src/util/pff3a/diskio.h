@@ -29,6 +29,7 @@ typedef enum {
 
 DSTATUS disk_initialize (void);
 DRESULT disk_readp (BYTE* buff, DWORD sector, UINT offser, UINT count);
+DRESULT disk_readm (BYTE* buff, DWORD sector, UINT count);	/* whole sectors, not used by pff itself */
 DRESULT disk_writep (const BYTE* buff, DWORD sc);
 
 #define STA_NOINIT		0x01	/* Drive not initialized */
@@ -0,0 +1,303 @@
+/***************************************************************************//**
+  * @file     prof.c
+  * @brief    Hardware performance counter profiler
+  * @details  Nested start/stop regions accumulating mcycle, minstret and optional mhpmcounter events.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <riscv-csr.h>
+
+#include "prof.h"
+
+// number of empty start/stop pairs used to measure overhead
+#define PROF_CAL_RUNS 16
+
+/**
+ * @struct s_prof_sample
+ * @brief counter snapshot
+ */
+struct s_prof_sample
+{
+  uint64_t cycles;
+  uint64_t instret;
+  uint64_t hpm[PROF_NUM_HPM];
+};
+
+/**
+ * @struct s_prof_frame
+ * @brief running region
+ */
+struct s_prof_frame
+{
+  int id;
+  uint64_t child;
+  struct s_prof_sample start;
+};
+
+static struct
+{
+  uint32_t num_regions;
+  uint32_t depth;
+  uint32_t errors;
+  struct s_prof_sample overhead;
+  struct s_prof_frame frames[PROF_MAX_DEPTH];
+  struct s_prof_region regions[PROF_MAX_REGIONS];
+} g_prof;
+
+// read a 64 bit counter on rv32, retry if the high half ticked between reads.
+#define PROF_READ64(name) \
+  static inline uint64_t read_##name(void) \
+  { \
+    uint32_t high; \
+    uint32_t low; \
+    do { \
+      high = csr_read_##name##h(); \
+      low  = (uint32_t)csr_read_##name(); \
+    } while(high != csr_read_##name##h()); \
+    return (((uint64_t)high) << 32) | low; \
+  }
+
+PROF_READ64(mcycle)
+PROF_READ64(minstret)
+#if PROF_HPM_EVENTS
+PROF_READ64(mhpmcounter3)
+PROF_READ64(mhpmcounter4)
+#endif
+
+// snapshot the counters
+static inline void readSample(struct s_prof_sample *p_sample)
+{
+#if PROF_HPM_EVENTS
+  p_sample->hpm[0]  = read_mhpmcounter3();
+  p_sample->hpm[1]  = read_mhpmcounter4();
+#endif
+  p_sample->instret = read_minstret();
+  p_sample->cycles  = read_mcycle();
+}
+
+// a - b - overhead, never below 0
+static inline uint64_t subSample(uint64_t a, uint64_t b, uint64_t overhead)
+{
+  uint64_t delta = a - b;
+
+  return (delta > overhead ? delta - overhead : 0);
+}
+
+// Initializes the profiler
+void initProf(uint32_t event3, uint32_t event4)
+{
+  int id;
+  int index;
+
+  memset(&g_prof, 0, sizeof(g_prof));
+
+#if PROF_HPM_EVENTS
+  csr_write_mhpmevent3(event3);
+  csr_write_mhpmevent4(event4);
+#else
+  (void)event3;
+  (void)event4;
+#endif
+
+#if PROF_COUNTINHIBIT
+  // make sure nothing is inhibited, the csr only exists from priv 1.11.
+  csr_write_mcountinhibit(0);
+#endif
+
+  // smallest cost of an empty region is what every region pays for itself.
+  id = getProfRegion("__overhead");
+
+  g_prof.overhead.cycles  = ~(uint64_t)0;
+  g_prof.overhead.instret = ~(uint64_t)0;
+
+  for(index = 0; index < PROF_CAL_RUNS; index++)
+  {
+    struct s_prof_sample before = g_prof.overhead;
+
+    memset(&g_prof.overhead, 0, sizeof(g_prof.overhead));
+
+    g_prof.regions[id].cycles  = 0;
+    g_prof.regions[id].instret = 0;
+
+    startProfRegion(id);
+    stopProfRegion(id);
+
+    g_prof.overhead = before;
+
+    if(g_prof.regions[id].cycles < g_prof.overhead.cycles) g_prof.overhead.cycles = g_prof.regions[id].cycles;
+
+    if(g_prof.regions[id].instret < g_prof.overhead.instret) g_prof.overhead.instret = g_prof.regions[id].instret;
+  }
+
+  // drop the calibration region
+  memset(&g_prof.regions[id], 0, sizeof(struct s_prof_region));
+
+  g_prof.num_regions = 0;
+}
+
+// find or add a region by name
+int getProfRegion(const char *p_name)
+{
+  uint32_t index;
+
+  if(!p_name) return -1;
+
+  for(index = 0; index < g_prof.num_regions; index++)
+  {
+    if(!strcmp(g_prof.regions[index].p_name, p_name)) return index;
+  }
+
+  if(g_prof.num_regions >= PROF_MAX_REGIONS) return -1;
+
+  g_prof.regions[g_prof.num_regions].p_name = p_name;
+
+  return g_prof.num_regions++;
+}
+
+// start a region
+void startProfRegion(int id)
+{
+  struct s_prof_frame *p_frame = NULL;
+
+  if((id < 0) || (id >= (int)g_prof.num_regions) || (g_prof.depth >= PROF_MAX_DEPTH))
+  {
+    g_prof.errors++;
+    return;
+  }
+
+  p_frame = &g_prof.frames[g_prof.depth++];
+
+  p_frame->id    = id;
+  p_frame->child = 0;
+
+  // counters last, so the bookkeeping above is not counted.
+  readSample(&p_frame->start);
+}
+
+// stop the innermost region
+void stopProfRegion(int id)
+{
+  int index;
+  uint64_t cycles;
+
+  struct s_prof_sample now;
+  struct s_prof_frame *p_frame = NULL;
+  struct s_prof_region *p_region = NULL;
+
+  // counters first, so the bookkeeping below is not counted.
+  readSample(&now);
+
+  if(!g_prof.depth)
+  {
+    g_prof.errors++;
+    return;
+  }
+
+  p_frame = &g_prof.frames[--g_prof.depth];
+
+  if(p_frame->id != id) g_prof.errors++;
+
+  p_region = &g_prof.regions[p_frame->id];
+
+  cycles = subSample(now.cycles, p_frame->start.cycles, g_prof.overhead.cycles);
+
+  p_region->calls++;
+  p_region->cycles  += cycles;
+  p_region->self    += (cycles > p_frame->child ? cycles - p_frame->child : 0);
+  p_region->instret += subSample(now.instret, p_frame->start.instret, g_prof.overhead.instret);
+
+  for(index = 0; index < PROF_NUM_HPM; index++)
+  {
+    p_region->hpm[index] += now.hpm[index] - p_frame->start.hpm[index];
+  }
+
+  // the parent does not own our time, or what it cost to measure it.
+  if(g_prof.depth) g_prof.frames[g_prof.depth-1].child += cycles + g_prof.overhead.cycles;
+}
+
+// get the counts of a region
+struct s_prof_region *getProfRegionCounts(int id)
+{
+  if((id < 0) || (id >= (int)g_prof.num_regions)) return NULL;
+
+  return &g_prof.regions[id];
+}
+
+// zero the counts of all regions
+void clrProf(void)
+{
+  uint32_t index;
+
+  for(index = 0; index < g_prof.num_regions; index++)
+  {
+    const char *p_name = g_prof.regions[index].p_name;
+
+    memset(&g_prof.regions[index], 0, sizeof(struct s_prof_region));
+
+    g_prof.regions[index].p_name = p_name;
+  }
+
+  g_prof.errors = 0;
+}
+
+// print all regions
+void printProfReport(void)
+{
+  uint32_t index;
+
+  printf("\n\r%-16s %8s %12s %12s %12s %10s %6s", "region", "calls", "cycles", "self", "instret", "cyc/call", "ipc%");
+#if PROF_HPM_EVENTS
+  printf(" %10s %10s", "hpm3", "hpm4");
+#endif
+  printf("\n\r");
+
+  for(index = 0; index < g_prof.num_regions; index++)
+  {
+    struct s_prof_region *p_region = &g_prof.regions[index];
+
+    printf("%-16s %8lu %12llu %12llu %12llu %10llu %6llu",
+           p_region->p_name,
+           (unsigned long)p_region->calls,
+           (unsigned long long)p_region->cycles,
+           (unsigned long long)p_region->self,
+           (unsigned long long)p_region->instret,
+           (unsigned long long)(p_region->calls ? p_region->cycles / p_region->calls : 0),
+           (unsigned long long)(p_region->cycles ? (p_region->instret * 100) / p_region->cycles : 0));
+#if PROF_HPM_EVENTS
+    printf(" %10llu %10llu", (unsigned long long)p_region->hpm[0], (unsigned long long)p_region->hpm[1]);
+#endif
+    printf("\n\r");
+  }
+
+  if(g_prof.errors) printf("PROF: %lu unbalanced start/stop\n\r", (unsigned long)g_prof.errors);
+}
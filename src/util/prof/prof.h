@@ -0,0 +1,207 @@
+/***************************************************************************//**
+  * @file     prof.h
+  * @brief    Hardware performance counter profiler
+  * @details  Nested start/stop regions accumulating mcycle, minstret and optional mhpmcounter events.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __PROF_H
+#define __PROF_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def PROF_MAX_REGIONS
+ * number of named regions
+ */
+#ifndef PROF_MAX_REGIONS
+#define PROF_MAX_REGIONS    32
+#endif
+
+/**
+ * @def PROF_MAX_DEPTH
+ * deepest region nesting
+ */
+#ifndef PROF_MAX_DEPTH
+#define PROF_MAX_DEPTH      16
+#endif
+
+/**
+ * @def PROF_HPM_EVENTS
+ * set to 1 if the core has mhpmcounter3/4, reading them
+ * on a core without them is an illegal instruction.
+ */
+#ifndef PROF_HPM_EVENTS
+#define PROF_HPM_EVENTS     0
+#endif
+
+/**
+ * @def PROF_COUNTINHIBIT
+ * set to 1 if the core has mcountinhibit (priv 1.11 and up),
+ * initProf then clears it so no counter is stopped. Priv 1.10
+ * cores like the E31 trap on it.
+ */
+#ifndef PROF_COUNTINHIBIT
+#define PROF_COUNTINHIBIT   0
+#endif
+
+/**
+ * @def PROF_NUM_HPM
+ * number of mhpmcounters used, 3 and 4.
+ */
+#define PROF_NUM_HPM        2
+
+/**
+ * @def PROF_START
+ * start a named region, the name lookup only happens the first time.
+ * Define PROF_DISABLE to compile regions out.
+ */
+/**
+ * @def PROF_STOP
+ * stop the innermost region, name must match PROF_START.
+ */
+#ifndef PROF_DISABLE
+#define PROF_START(name) \
+  do { \
+    static int __prof_id = -1; \
+    if(__prof_id < 0) __prof_id = getProfRegion(name); \
+    startProfRegion(__prof_id); \
+  } while(0)
+
+#define PROF_STOP(name) \
+  do { \
+    static int __prof_id = -1; \
+    if(__prof_id < 0) __prof_id = getProfRegion(name); \
+    stopProfRegion(__prof_id); \
+  } while(0)
+#else
+#define PROF_START(name) do { } while(0)
+#define PROF_STOP(name)  do { } while(0)
+#endif
+
+/**
+ * @struct s_prof_region
+ * @brief accumulated counts for a region
+ */
+struct s_prof_region
+{
+  /**
+  * @var s_prof_region::p_name
+  * region name
+  */
+  const char *p_name;
+  /**
+  * @var s_prof_region::calls
+  * number of start/stop pairs
+  */
+  uint32_t calls;
+  /**
+  * @var s_prof_region::cycles
+  * cycles including nested regions
+  */
+  uint64_t cycles;
+  /**
+  * @var s_prof_region::self
+  * cycles not in nested regions
+  */
+  uint64_t self;
+  /**
+  * @var s_prof_region::instret
+  * instructions retired including nested regions
+  */
+  uint64_t instret;
+  /**
+  * @var s_prof_region::hpm
+  * mhpmcounter3/4 events including nested regions
+  */
+  uint64_t hpm[PROF_NUM_HPM];
+};
+
+/*********************************************//**
+  * @brief Initializes the profiler, clears all regions
+  * and measures the start/stop overhead to remove it.
+  *
+  * @param event3 mhpmevent3 selector, core specific
+  * (SiFive E31 0x0102 is I-cache miss), only used with PROF_HPM_EVENTS.
+  * @param event4 mhpmevent4 selector, core specific
+  * (SiFive E31 0x2001 is branch mispredict), only used with PROF_HPM_EVENTS.
+  *************************************************/
+void initProf(uint32_t event3, uint32_t event4);
+
+/*********************************************//**
+  * @brief find or add a region by name.
+  *
+  * @param p_name region name, must stay valid (string literal).
+  *
+  * @return region id, -1 if out of regions.
+  *************************************************/
+int getProfRegion(const char *p_name);
+
+/*********************************************//**
+  * @brief start a region, nests inside the running one.
+  *
+  * @param id region id from getProfRegion
+  *************************************************/
+void startProfRegion(int id);
+
+/*********************************************//**
+  * @brief stop the innermost region.
+  *
+  * @param id region id, must be the innermost running region.
+  *************************************************/
+void stopProfRegion(int id);
+
+/*********************************************//**
+  * @brief get the counts of a region.
+  *
+  * @param id region id from getProfRegion
+  *
+  * @return region or NULL for a bad id.
+  *************************************************/
+struct s_prof_region *getProfRegionCounts(int id);
+
+/*********************************************//**
+  * @brief zero the counts of all regions, keep the names.
+  *************************************************/
+void clrProf(void);
+
+/*********************************************//**
+  * @brief print all regions with printf.
+  *************************************************/
+void printProfReport(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,369 @@
+/***************************************************************************//**
+  * @file     sched.c
+  * @brief    Cooperative task scheduler
+  * @details  Stackful tasks with yield, sleep and event waits, switched in assembly.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <irq/nested-irq.h>
+
+#include "sched.h"
+
+// save callee saved registers in p_from, load p_to and return into it (sched_switch.S).
+void schedSwitch(struct s_sched_context *p_from, struct s_sched_context *p_to);
+
+static struct
+{
+  struct s_clint *p_clint;
+  struct s_sched_context context;
+  struct s_sched_task *p_head;
+  struct s_sched_task *p_tail;
+  struct s_sched_task *p_current;
+} g_sched;
+
+// first code a new task runs, schedSwitch returns here on a fresh stack.
+static void taskEntry(void)
+{
+  struct s_sched_task *p_task = g_sched.p_current;
+
+  p_task->task(p_task->p_arg);
+
+  p_task->state = SCHED_DONE;
+
+  // the scheduler frees the stack, never switched back to.
+  schedSwitch(&p_task->context, &g_sched.context);
+
+  for(;;);
+}
+
+// switch from the running task back to the scheduler
+static void blockTask(void)
+{
+  schedSwitch(&g_sched.p_current->context, &g_sched.context);
+}
+
+// wake blocked tasks whose event, condition or deadline came, return how many are ready.
+static int pollTasks(void *p_ctx)
+{
+  int ready = 0;
+  uint64_t now;
+
+  struct s_sched_task *p_task = NULL;
+
+  (void)p_ctx;
+
+  now = getClintMTime(g_sched.p_clint);
+
+  for(p_task = g_sched.p_head; p_task; p_task = p_task->p_next)
+  {
+    switch(p_task->state)
+    {
+      case SCHED_SLEEPING:
+        if(now >= p_task->wake) p_task->state = SCHED_READY;
+        break;
+      case SCHED_WAITING:
+        if(p_task->p_event && __atomic_exchange_n(&p_task->p_event->signaled, 0, __ATOMIC_ACQUIRE))
+        {
+          p_task->result = 0;
+          p_task->state  = SCHED_READY;
+        }
+        else if(p_task->cond && p_task->cond(p_task->p_ctx))
+        {
+          p_task->result = 0;
+          p_task->state  = SCHED_READY;
+        }
+        else if(now >= p_task->wake)
+        {
+          p_task->result = 1;
+          p_task->state  = SCHED_READY;
+        }
+        break;
+      default:
+        break;
+    }
+
+    if(p_task->state == SCHED_READY) ready++;
+  }
+
+  return ready;
+}
+
+// earliest deadline of the blocked tasks
+static uint64_t nextWake(void)
+{
+  uint64_t wake = CLINT_WAIT_FOREVER;
+
+  struct s_sched_task *p_task = NULL;
+
+  for(p_task = g_sched.p_head; p_task; p_task = p_task->p_next)
+  {
+    if((p_task->state == SCHED_SLEEPING) || (p_task->state == SCHED_WAITING))
+    {
+      if(p_task->wake < wake) wake = p_task->wake;
+    }
+  }
+
+  return wake;
+}
+
+// free tasks that returned
+static void reapTasks(void)
+{
+  struct s_sched_task *p_task = g_sched.p_head;
+  struct s_sched_task *p_prev = NULL;
+
+  while(p_task)
+  {
+    struct s_sched_task *p_next = p_task->p_next;
+
+    if(p_task->state == SCHED_DONE)
+    {
+      if(p_prev)
+      {
+        p_prev->p_next = p_next;
+      }
+      else
+      {
+        g_sched.p_head = p_next;
+      }
+
+      if(g_sched.p_tail == p_task) g_sched.p_tail = p_prev;
+
+      free(p_task->p_stack);
+      free(p_task);
+    }
+    else
+    {
+      p_prev = p_task;
+    }
+
+    p_task = p_next;
+  }
+}
+
+// waitClintTimer hook, park the task until the condition or deadline
+static int waitYield(clint_wait_cond cond, void *p_ctx, uint64_t deadline)
+{
+  struct s_sched_task *p_task = g_sched.p_current;
+
+  if(!p_task) return -1;
+
+  // a nested handler runs with MIE on, switching out here would leave its trap open.
+  if(getNestedIrqDepth()) return -1;
+
+  if(cond && cond(p_ctx)) return 0;
+
+  p_task->cond    = cond;
+  p_task->p_ctx   = p_ctx;
+  p_task->p_event = NULL;
+  p_task->wake    = deadline;
+  p_task->state   = SCHED_WAITING;
+
+  blockTask();
+
+  p_task->cond = NULL;
+
+  return p_task->result;
+}
+
+// condition for waiting on an event outside of a task
+static int takeEvent(void *p_ctx)
+{
+  struct s_sched_event *p_event = (struct s_sched_event *)p_ctx;
+
+  return (__atomic_exchange_n(&p_event->signaled, 0, __ATOMIC_ACQUIRE) != 0);
+}
+
+// Initializes the scheduler
+void initSched(struct s_clint *p_clint)
+{
+  if(!p_clint) return;
+
+  memset(&g_sched, 0, sizeof(g_sched));
+
+  g_sched.p_clint = p_clint;
+
+  setClintTimerYield(waitYield);
+}
+
+// create a task
+struct s_sched_task *createSchedTask(const char *p_name, sched_task_fn task, void *p_arg, uint32_t stack_size)
+{
+  struct s_sched_task *p_task = NULL;
+
+  if(!task) return NULL;
+
+  if(stack_size < SCHED_STACK_MIN) stack_size = SCHED_STACK_MIN;
+
+  p_task = malloc(sizeof(struct s_sched_task));
+
+  if(!p_task) return NULL;
+
+  memset(p_task, 0, sizeof(struct s_sched_task));
+
+  p_task->p_stack = malloc(stack_size);
+
+  if(!p_task->p_stack)
+  {
+    free(p_task);
+    return NULL;
+  }
+
+  p_task->p_name = p_name;
+  p_task->task   = task;
+  p_task->p_arg  = p_arg;
+  p_task->state  = SCHED_READY;
+
+  // psABI wants a 16 byte aligned stack
+  p_task->context.sp = ((uint32_t)(p_task->p_stack + stack_size)) & ~0xFUL;
+  p_task->context.ra = (uint32_t)taskEntry;
+
+  if(g_sched.p_tail)
+  {
+    g_sched.p_tail->p_next = p_task;
+  }
+  else
+  {
+    g_sched.p_head = p_task;
+  }
+
+  g_sched.p_tail = p_task;
+
+  return p_task;
+}
+
+// run tasks until all of them are done
+void runSched(void)
+{
+  uint64_t now;
+  uint64_t wake;
+
+  struct s_sched_task *p_task = NULL;
+
+  if(!g_sched.p_clint) return;
+
+  while(g_sched.p_head)
+  {
+    for(p_task = g_sched.p_head; p_task; p_task = p_task->p_next)
+    {
+      if(p_task->state != SCHED_READY) continue;
+
+      g_sched.p_current = p_task;
+
+      schedSwitch(&g_sched.context, &p_task->context);
+
+      g_sched.p_current = NULL;
+    }
+
+    reapTasks();
+
+    if(pollTasks(NULL)) continue;
+
+    if(!g_sched.p_head) break;
+
+    // every task is blocked, sleep until an interrupt, a deadline or the next poll.
+    wake = nextWake();
+    now  = getClintMTime(g_sched.p_clint);
+
+    waitClintTimer(g_sched.p_clint, pollTasks, NULL, (wake == CLINT_WAIT_FOREVER ? CLINT_WAIT_FOREVER : (wake > now ? wake - now : 0)), SCHED_IDLE_POLL);
+  }
+}
+
+// give the other ready tasks a turn
+void yieldSched(void)
+{
+  if(!g_sched.p_current) return;
+
+  blockTask();
+}
+
+// block the calling task for a number of mtime ticks
+void sleepSched(uint64_t ticks)
+{
+  struct s_sched_task *p_task = g_sched.p_current;
+
+  if(!p_task)
+  {
+    sleepClintTimer(g_sched.p_clint, ticks);
+    return;
+  }
+
+  p_task->wake  = getClintMTime(g_sched.p_clint) + ticks;
+  p_task->state = SCHED_SLEEPING;
+
+  blockTask();
+}
+
+// Initializes an event
+void initSchedEvent(struct s_sched_event *p_event)
+{
+  if(!p_event) return;
+
+  p_event->signaled = 0;
+}
+
+// signal an event
+void signalSchedEvent(struct s_sched_event *p_event)
+{
+  if(!p_event) return;
+
+  __atomic_store_n(&p_event->signaled, 1, __ATOMIC_RELEASE);
+}
+
+// block the calling task until an event is signaled
+int waitSchedEvent(struct s_sched_event *p_event, uint64_t timeout)
+{
+  struct s_sched_task *p_task = g_sched.p_current;
+
+  if(!p_event) return 1;
+
+  if(takeEvent(p_event)) return 0;
+
+  if(!p_task) return waitClintTimer(g_sched.p_clint, takeEvent, p_event, timeout, SCHED_IDLE_POLL);
+
+  p_task->cond    = NULL;
+  p_task->p_event = p_event;
+  p_task->wake    = (timeout == CLINT_WAIT_FOREVER ? CLINT_WAIT_FOREVER : getClintMTime(g_sched.p_clint) + timeout);
+  p_task->state   = SCHED_WAITING;
+
+  blockTask();
+
+  p_task->p_event = NULL;
+
+  return p_task->result;
+}
+
+// get the running task
+struct s_sched_task *getSchedTask(void)
+{
+  return g_sched.p_current;
+}
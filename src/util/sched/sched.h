@@ -0,0 +1,254 @@
+/***************************************************************************//**
+  * @file     sched.h
+  * @brief    Cooperative task scheduler
+  * @details  Stackful tasks with yield, sleep and event waits, switched in assembly.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __SCHED_H
+#define __SCHED_H
+
+#include <stdint.h>
+
+#include <clint.h>
+#include <clint_timer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def SCHED_IDLE_POLL
+ * mtime ticks between wait condition checks when every task is blocked,
+ * conditions with an interrupt are checked as soon as it fires.
+ */
+#ifndef SCHED_IDLE_POLL
+#define SCHED_IDLE_POLL     4096
+#endif
+
+/**
+ * @def SCHED_STACK_MIN
+ * smallest task stack in bytes
+ */
+#define SCHED_STACK_MIN     256
+
+/**
+ * @typedef sched_task_fn
+ * @brief task entry, the task is done when it returns.
+ */
+typedef void (*sched_task_fn)(void *p_arg);
+
+/**
+ * @struct s_sched_context
+ * @brief callee saved registers, everything else is saved by the
+ * C caller of schedSwitch. Layout is used by sched_switch.S.
+ */
+struct s_sched_context
+{
+  /**
+  * @var s_sched_context::ra
+  * return address, where the task resumes
+  */
+  uint32_t ra;
+  /**
+  * @var s_sched_context::sp
+  * stack pointer
+  */
+  uint32_t sp;
+  /**
+  * @var s_sched_context::s
+  * s0 to s11
+  */
+  uint32_t s[12];
+};
+
+/**
+ * @struct s_sched_event
+ * @brief auto reset event, safe to signal from interrupt handlers.
+ */
+struct s_sched_event
+{
+  /**
+  * @var s_sched_event::signaled
+  * set by signalSchedEvent, cleared by the waiter that takes it.
+  */
+  volatile uint32_t signaled;
+};
+
+/**
+ * @struct s_sched_task
+ * @brief A task, created by createSchedTask.
+ */
+struct s_sched_task
+{
+  /**
+  * @var s_sched_task::context
+  * saved registers while switched out, must be first.
+  */
+  struct s_sched_context context;
+  /**
+  * @var s_sched_task::p_next
+  * next task in the run list
+  */
+  struct s_sched_task *p_next;
+  /**
+  * @var s_sched_task::p_name
+  * name for debug
+  */
+  const char *p_name;
+  /**
+  * @var s_sched_task::task
+  * entry function
+  */
+  sched_task_fn task;
+  /**
+  * @var s_sched_task::p_arg
+  * passed to the entry function
+  */
+  void *p_arg;
+  /**
+  * @var s_sched_task::p_stack
+  * stack memory
+  */
+  uint8_t *p_stack;
+  /**
+  * @var s_sched_task::wake
+  * mtime deadline when sleeping or waiting
+  */
+  uint64_t wake;
+  /**
+  * @var s_sched_task::cond
+  * condition when waiting in a driver
+  */
+  clint_wait_cond cond;
+  /**
+  * @var s_sched_task::p_ctx
+  * passed to cond
+  */
+  void *p_ctx;
+  /**
+  * @var s_sched_task::p_event
+  * event when waiting on one
+  */
+  struct s_sched_event *p_event;
+  /**
+  * @var s_sched_task::result
+  * 0 woken by the event/condition, 1 by the deadline
+  */
+  int result;
+  /**
+  * @var s_sched_task::state
+  * run state
+  */
+  enum
+  {
+    SCHED_READY,
+    SCHED_SLEEPING,
+    SCHED_WAITING,
+    SCHED_DONE
+  } state;
+};
+
+/*********************************************//**
+  * @brief Initializes the scheduler, no tasks.
+  *
+  * Hooks waitClintTimer so drivers blocking inside a
+  * task yield to the other tasks instead of spinning.
+  *
+  * @param p_clint pre-initialized struct from initClint,
+  * used for sleeps and timeouts.
+  *************************************************/
+void initSched(struct s_clint *p_clint);
+
+/*********************************************//**
+  * @brief create a task, it runs once runSched is called.
+  *
+  * @param p_name name for debug
+  * @param task entry function
+  * @param p_arg passed to the entry function
+  * @param stack_size stack bytes, at least SCHED_STACK_MIN.
+  *
+  * @return task or NULL if out of memory.
+  *************************************************/
+struct s_sched_task *createSchedTask(const char *p_name, sched_task_fn task, void *p_arg, uint32_t stack_size);
+
+/*********************************************//**
+  * @brief run tasks until all of them are done, the
+  * hart sleeps in wfi when every task is blocked.
+  *************************************************/
+void runSched(void);
+
+/*********************************************//**
+  * @brief give the other ready tasks a turn.
+  *************************************************/
+void yieldSched(void);
+
+/*********************************************//**
+  * @brief block the calling task for a number of mtime ticks.
+  *
+  * @param ticks mtime ticks to sleep
+  *************************************************/
+void sleepSched(uint64_t ticks);
+
+/*********************************************//**
+  * @brief Initializes an event, not signaled.
+  *
+  * @param p_event event to initialize
+  *************************************************/
+void initSchedEvent(struct s_sched_event *p_event);
+
+/*********************************************//**
+  * @brief signal an event, safe from interrupt handlers.
+  *
+  * @param p_event event to signal
+  *************************************************/
+void signalSchedEvent(struct s_sched_event *p_event);
+
+/*********************************************//**
+  * @brief block the calling task until an event is signaled.
+  *
+  * @param p_event event to wait on
+  * @param timeout mtime ticks or CLINT_WAIT_FOREVER
+  *
+  * @return 0 if signaled, 1 on timeout.
+  *************************************************/
+int waitSchedEvent(struct s_sched_event *p_event, uint64_t timeout);
+
+/*********************************************//**
+  * @brief get the running task.
+  *
+  * @return task, NULL when called outside of a task.
+  *************************************************/
+struct s_sched_task *getSchedTask(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -36,6 +36,8 @@
 #include <string.h>
 
 #include "spi.h"
+#include "clint.h"
+#include "clint_timer.h"
 #include "sdcard_spi.h"
 
 // MAGIC
@@ -53,6 +55,14 @@
 #define SD_DATA_REJ_WRITE_TOKEN 0x0D
 #define SD_DATA_ACCEPTED_MASK   0x0F
 #define SD_INDEX_OFFSET_MASK    0x01FF
+#define SD_WRITE_TIMEOUT_MS     500 //SDXC worst case write busy, SDSC/SDHC is 250
+#define SD_STOP_TIMEOUT_MS      100 //busy after CMD12 ends a multiple block read, spec read access limit
+#define SD_BUSY_POLL_US         100
+#define SD_POWER_UP_US          1000 //spec minimum from supply ramp to first clocks
+#define SD_HOLD_CLOCKS          8    //spec gap between commands, in spi clocks
+#define SD_CLOCKS_US(clocks, freq) ((((clocks) * 1000000) + (freq) - 1) / (freq))
+#define SD_HOLD_SLOW_US         SD_CLOCKS_US(SD_HOLD_CLOCKS, SD_SLOW_FREQ_HZ)
+#define SD_HOLD_FAST_US         SD_CLOCKS_US(SD_HOLD_CLOCKS, SD_FAST_FREQ_HZ)
 #define SD_ERROR_RETURN         1 //same as STA_NOINIT from ff15/petitFS
 #define SD_NOERROR_RETURN       0 //same as STA_INIT from ff15/petitFS
 
@@ -65,9 +75,11 @@
 // command indexs (6 bits)
 #define SD_CMD0     0x00 // 0, reset
 #define SD_CMD8     0x08 // 8, request interface condition information
+#define SD_CMD12    0x0C //12, Stop a multiple block read
 #define SD_CMD13    0x0D //13, request status register
 #define SD_CMD16    0x10 //16, set the block length in bytes for block commands. Fixed to 512 for high capacity cards.
 #define SD_CMD17    0x11 //17, Read a block of size from set block length command
+#define SD_CMD18    0x12 //18, Read blocks until stopped by command 12
 #define SD_CMD24    0x18 //24, Write a block of size from set block length command
 #define SD_CMD55    0x37 //55, Define next command sent as a application command
 #define SD_CMD58    0x3A //58, Read the OCR register
@@ -143,6 +155,8 @@ static inline uint8_t recvRespOneByte(struct s_spi *p_spi, uint32_t tries);
 static inline void recvRespBytes(struct s_spi *p_spi, uint8_t *p_buff, const uint8_t num_bytes, uint32_t tries);
 // wait for transmission to be over and delay for a bit to hold chip select high.
 static inline void waitForTrans(struct s_spi *p_spi, uint32_t len);
+// wait condition, card releases data out from 0x00 when it is done being busy.
+static int sdNotBusy(void *p_ctx);
 
 // Initializes sdcard over spi device for data mode
 uint8_t initSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t memory_address, uint8_t cs_num)
@@ -169,13 +183,14 @@ uint8_t initSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t memory_address
   p_sdcard_spi->state = NOT_READY;
   p_sdcard_spi->p_spi = p_spi;
   p_sdcard_spi->cs_num = cs_num;
+  p_sdcard_spi->p_clint = initClint(CLINT_ADDR);
   
   // clear out read buffer.
   setSpiChipSelect(p_spi, cs_num);
   
   if(getSpiFifoEnabled(p_spi)) setSpiResetRXfifo(p_spi);
   
-  waitForTrans(p_spi, 100);
+  waitForTrans(p_spi, SD_POWER_UP_US);
   
   setSpiClockFreq(p_spi, SD_SLOW_FREQ_HZ);
   
@@ -194,7 +209,7 @@ uint8_t initSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t memory_address
       sendRawData(p_spi, SD_INIT_WORD);
     }
     
-    waitForTrans(p_spi, 100);
+    waitForTrans(p_spi, SD_HOLD_SLOW_US);
     
     if(getSpiFifoEnabled(p_spi)) setSpiResetRXfifo(p_spi);
     
@@ -207,7 +222,7 @@ uint8_t initSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t memory_address
     
     clrSpiForceSelect(p_spi);
     
-    waitForTrans(p_spi, 100);
+    waitForTrans(p_spi, SD_HOLD_SLOW_US);
   }
   while((--init_attempts > 0) && (p_sdcard_spi->last_r1 != SD_RESP_IDLE_BIT_MASK_R1));
         
@@ -256,7 +271,7 @@ uint8_t initSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t memory_address
       return SD_ERROR_RETURN;
   }
 
-  waitForTrans(p_spi, 10);
+  waitForTrans(p_spi, SD_HOLD_SLOW_US);
   
   //set clock to fast
   setSpiClockFreq(p_spi, SD_FAST_FREQ_HZ);
@@ -279,7 +294,7 @@ uint8_t initSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t memory_address
     return SD_ERROR_RETURN;
   }
 
-  waitForTrans(p_spi, 100);
+  waitForTrans(p_spi, SD_HOLD_FAST_US);
   
   //send ACMD41 till we come out of idle
   init_attempts = SD_INIT_ATTEMPT;
@@ -294,7 +309,7 @@ uint8_t initSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t memory_address
     
     clrSpiForceSelect(p_spi);
     
-    waitForTrans(p_spi, 10);
+    waitForTrans(p_spi, SD_HOLD_FAST_US);
     
     // if we start getting FFF something has gone wrong in the init, we can try to reset it with command 0 and see what happens.
     if(p_sdcard_spi->last_r1 == SD_INIT_WORD)
@@ -307,7 +322,7 @@ uint8_t initSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t memory_address
       
       clrSpiForceSelect(p_spi);
       
-      waitForTrans(p_spi, 10);
+      waitForTrans(p_spi, SD_HOLD_FAST_US);
     }
   }
   while((--init_attempts > 0) && (p_sdcard_spi->last_r1));
@@ -319,7 +334,7 @@ uint8_t initSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t memory_address
     return SD_ERROR_RETURN;
   }
   
-  waitForTrans(p_spi, 1);
+  waitForTrans(p_spi, SD_HOLD_FAST_US);
     
   setSpiForceSelect(p_spi);
   
@@ -371,7 +386,7 @@ uint8_t initSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t memory_address
     p_sdcard_spi->v1 = 1;
   }
   
-  waitForTrans(p_spi, 10);
+  waitForTrans(p_spi, SD_HOLD_FAST_US);
   
   p_sdcard_spi->last_error_token = 0;
 
@@ -451,6 +466,97 @@ uint8_t readSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t address, uint8
   return SD_NOERROR_RETURN;
 }
 
+// Read consecutive 512 byte blocks with one command.
+uint8_t readSdcardSpiBlocks(struct s_sdcard_spi *p_sdcard_spi, uint32_t address, uint8_t *p_buffer, uint32_t count)
+{
+  int index;
+  
+  volatile uint8_t crc[2];
+  
+  uint8_t error = SD_NOERROR_RETURN;
+  
+  switch(p_sdcard_spi->state)
+  {
+    case READY_HIGH_CAPACITY_V2:
+    case READY_STANDARD_CAPACITY_V2:
+    case READY_STANDARD_CAPACITY_V1:
+      break;
+    default:
+      return SD_ERROR_RETURN;
+  }
+  
+  if(!count) return SD_NOERROR_RETURN;
+  
+  // one block is cheaper without the stop command.
+  if(count == 1) return readSdcardSpi(p_sdcard_spi, address, p_buffer, 0, SD_FIXED_BYTES);
+  
+  waitForTrans(p_sdcard_spi->p_spi, 0);
+  
+  address = (p_sdcard_spi->v1 ? address * SD_FIXED_BYTES : address);
+  
+  setSpiForceSelect(p_sdcard_spi->p_spi);
+  
+  sendCommand(p_sdcard_spi->p_spi, SD_CMD18, address, SD_CMD_NULL_CRC);
+  
+  p_sdcard_spi->last_r1 = recvRespOneByte(p_sdcard_spi->p_spi, SD_ATTEMPT_FAST);
+  
+  if(p_sdcard_spi->last_r1 == SD_INIT_WORD) 
+  {
+    clrSpiForceSelect(p_sdcard_spi->p_spi);
+    
+    p_sdcard_spi->state = READ_FAIL_TIMEOUT;
+    
+    return SD_ERROR_RETURN;
+  }
+  
+  // each block has its own start token and crc, the card keeps sending until stopped.
+  while(count--)
+  {
+    p_sdcard_spi->last_error_token = recvRespOneByte(p_sdcard_spi->p_spi, SD_ATTEMPT_FAST);
+    
+    if(p_sdcard_spi->last_error_token != SD_START_TOKEN) 
+    {
+      p_sdcard_spi->state = READ_FAIL_START;
+      
+      error = SD_ERROR_RETURN;
+      
+      break;
+    }
+    
+    for(index = 0; index < SD_FIXED_BYTES; index++)
+    {
+      p_buffer[index] = recvRawData(p_sdcard_spi->p_spi);
+    }
+    
+    p_buffer += SD_FIXED_BYTES;
+    
+    crc[0] = recvRawData(p_sdcard_spi->p_spi);
+    crc[1] = recvRawData(p_sdcard_spi->p_spi);
+  }
+  
+  sendCommand(p_sdcard_spi->p_spi, SD_CMD12, SD_CMD_NULL_ARG, SD_CMD_NULL_CRC);
+  
+  // stuff byte, the card may still be clocking out data when the stop arrives.
+  recvRawData(p_sdcard_spi->p_spi);
+  
+  p_sdcard_spi->last_r1 = recvRespOneByte(p_sdcard_spi->p_spi, SD_ATTEMPT_FAST);
+  
+  // R1b, data out is held at 00 while the card is busy stopping.
+  if(waitClintTimer(p_sdcard_spi->p_clint, sdNotBusy, p_sdcard_spi->p_spi, calcMtimecmpMilliseconds(BUS_FREQ_HZ, SD_STOP_TIMEOUT_MS), calcMtimecmpMicroseconds(BUS_FREQ_HZ, SD_BUSY_POLL_US)))
+  {
+    p_sdcard_spi->state = READ_FAIL_TIMEOUT;
+    
+    error = SD_ERROR_RETURN;
+  }
+  
+  clrSpiForceSelect(p_sdcard_spi->p_spi);
+  
+  if(getSpiFifoEnabled(p_sdcard_spi->p_spi)) setSpiResetRXfifo(p_sdcard_spi->p_spi);
+  
+  //check CRC in future
+  return error;
+}
+
 // Write the sdcard over spi in 512 byte blocks for all standards.
 uint8_t writeSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t address, uint8_t *p_buffer, uint16_t len)
 {
@@ -510,9 +616,15 @@ uint8_t writeSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t address, uint
     return SD_ERROR_RETURN;
   }
   
-  //if 00 card is busy writing... lets wait.
-  //should time this out.
-  while(!recvRawData(p_sdcard_spi->p_spi));
+  //if 00 card is busy writing... lets wait, sleeping between polls.
+  if(waitClintTimer(p_sdcard_spi->p_clint, sdNotBusy, p_sdcard_spi->p_spi, calcMtimecmpMilliseconds(BUS_FREQ_HZ, SD_WRITE_TIMEOUT_MS), calcMtimecmpMicroseconds(BUS_FREQ_HZ, SD_BUSY_POLL_US)))
+  {
+    clrSpiForceSelect(p_sdcard_spi->p_spi);
+    
+    p_sdcard_spi->state = WRITE_FAIL;
+    
+    return SD_ERROR_RETURN;
+  }
   
   clrSpiForceSelect(p_sdcard_spi->p_spi);
   
@@ -569,7 +681,7 @@ static inline void sendAppCommand(struct s_spi *p_spi, uint8_t acmd, uint32_t ar
   
   clrSpiForceSelect(p_spi);
   
-  __delay_us(100);
+  __delay_us(SD_HOLD_FAST_US);
   
   setSpiForceSelect(p_spi);
   
@@ -632,3 +744,8 @@ static inline void waitForTrans(struct s_spi *p_spi, uint32_t len)
   
   __delay_us(len);
 }
+
+static int sdNotBusy(void *p_ctx)
+{
+  return (recvRawData((struct s_spi *)p_ctx) != 0);
+}
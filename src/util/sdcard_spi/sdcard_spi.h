@@ -40,6 +40,8 @@ extern "C" {
 
 #include <stdint.h>
 
+struct s_clint;
+
 /**
  * @struct s_sdcard_spi
  * @brief A struct to store current state of the sdcard spi software protocol
@@ -75,6 +77,9 @@ struct s_sdcard_spi
   } state;
   
   struct s_spi *p_spi;
+  
+  // mtime for the busy timeouts, they hold without the clint timer service.
+  struct s_clint *p_clint;
 };
 
 /*********************************************//**
@@ -105,6 +110,19 @@ uint8_t initSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t memory_address
   *************************************************/
 uint8_t readSdcardSpi(struct s_sdcard_spi *p_sdcard_spi, uint32_t address, uint8_t *p_buffer, uint16_t offset, uint16_t len);
 
+/*********************************************//**
+  * @brief Read consecutive 512 byte blocks with one read command (CMD18),
+  * saving the command and response of each single block read.
+  *
+  * @param p_sdcard_spi is struct containing device information from init.
+  * @param address first block to read, even for v1 (byte size is set to 512).
+  * @param p_buffer array of uint8_t (bytes), count * 512 bytes long.
+  * @param count number of blocks to read.
+  * 
+  * @return 0 on no error, 1 for an error.
+  *************************************************/
+uint8_t readSdcardSpiBlocks(struct s_sdcard_spi *p_sdcard_spi, uint32_t address, uint8_t *p_buffer, uint32_t count);
+
 /*********************************************//**
   * @brief Write the sdcard over spi in 512 byte blocks for all standards.
   *
@@ -0,0 +1,358 @@
+/***************************************************************************//**
+  * @file     vidplay.c
+  * @brief    Frame sequence player for the AXI TFT
+  * @details  Streams run length and delta coded frames from a Petit FatFs file into fbflip back buffers.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#include <base.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <clint_timer.h>
+#include <fbflip.h>
+#include <pff3a/diskio.h>
+
+#include "vidplay.h"
+
+// file sector of the first frame record, the header is one sector.
+#define FIRST_RECORD  1
+
+// map the open file to runs of card sectors, following the cluster chain once with pf_lseek.
+static int mapExtents(struct s_vidplay *p_vidplay, FATFS *p_fs)
+{
+  uint32_t cluster_bytes = (uint32_t)p_fs->csize * VIDPLAY_SECTOR;
+  uint32_t clusters = (p_fs->fsize + cluster_bytes - 1) / cluster_bytes;
+
+  CLUST cluster = p_fs->org_clust;
+
+  for(uint32_t index = 0; index < clusters; index++)
+  {
+    uint32_t sector = 0;
+
+    struct s_vidplay_extent *p_extent = &p_vidplay->extents[p_vidplay->num_extents];
+
+    // one byte into the cluster leaves curr_clust on it, each seek follows one link.
+    if(index)
+    {
+      if(pf_lseek(index * cluster_bytes + 1)) return 1;
+
+      cluster = p_fs->curr_clust;
+    }
+
+    sector = p_fs->database + (cluster - 2) * p_fs->csize;
+
+    // the next cluster on the card grows the last run.
+    if(p_vidplay->num_extents && (p_extent[-1].sector + p_extent[-1].count == sector))
+    {
+      p_extent[-1].count += p_fs->csize;
+
+      continue;
+    }
+
+    if(p_vidplay->num_extents >= VIDPLAY_MAX_EXTENTS) return 1;
+
+    p_extent->sector = sector;
+    p_extent->count  = p_fs->csize;
+
+    p_vidplay->num_extents++;
+  }
+
+  return (pf_lseek(0) != FR_OK);
+}
+
+// read whole file sectors, one multiple block read per extent they cross.
+static int readSectors(struct s_vidplay *p_vidplay, uint32_t sector, uint32_t count, uint8_t *p_dest)
+{
+  for(uint32_t index = 0; count && (index < p_vidplay->num_extents); index++)
+  {
+    uint32_t run = 0;
+
+    struct s_vidplay_extent *p_extent = &p_vidplay->extents[index];
+
+    if(sector >= p_extent->count)
+    {
+      sector -= p_extent->count;
+
+      continue;
+    }
+
+    run = p_extent->count - sector;
+
+    if(run > count) run = count;
+
+    if(disk_readm(p_dest, p_extent->sector + sector, run)) return 1;
+
+    p_dest += run * VIDPLAY_SECTOR;
+    count  -= run;
+    sector  = 0;
+  }
+
+  return (count != 0);
+}
+
+// run a record's ops into a framebuffer, rows are whole word fills and copies.
+static int runOps(struct s_vidplay *p_vidplay, uint32_t vmem_addr, const struct s_vidplay_frame *p_frame)
+{
+  uint32_t x = 0;
+  uint32_t y = 0;
+
+  const uint32_t width  = p_vidplay->header.width;
+  const uint32_t height = p_vidplay->header.height;
+
+  const uint32_t *p_op  = (const uint32_t *)(p_frame + 1);
+  const uint32_t *p_end = p_op + p_frame->words;
+
+  while(p_op < p_end)
+  {
+    uint32_t op = *p_op++;
+    uint32_t count = op & VIDPLAY_OP_COUNT_MASK;
+
+    switch(op >> VIDPLAY_OP_SHIFT)
+    {
+      case VIDPLAY_OP_SKIP:
+        // unchanged pixels, a still frame is one skip.
+        x += count;
+        y += x / width;
+        x %= width;
+        continue;
+      case VIDPLAY_OP_FILL:
+        if((x + count > width) || (y >= height) || (p_op >= p_end)) return 1;
+        fillAxiTftVmemRect(vmem_addr, p_vidplay->x + x, p_vidplay->y + y, count, 1, *p_op++);
+        break;
+      case VIDPLAY_OP_COPY:
+        if((x + count > width) || (y >= height) || ((uint32_t)(p_end - p_op) < count)) return 1;
+        blitAxiTftVmemRect(vmem_addr, p_vidplay->x + x, p_vidplay->y + y, count, 1, p_op, count);
+        p_op += count;
+        break;
+      default:
+        return 1;
+    }
+
+    x += count;
+
+    if(x == width)
+    {
+      x = 0;
+      y++;
+    }
+  }
+
+  return 0;
+}
+
+// open a video file
+int openVidPlay(struct s_vidplay *p_vidplay, FATFS *p_fs, struct s_clint *p_clint, const char *p_path)
+{
+  UINT len = 0;
+
+  if(!p_vidplay || !p_fs || !p_clint || !p_path) return 1;
+
+  memset(p_vidplay, 0, sizeof(*p_vidplay));
+
+  p_vidplay->p_clint = p_clint;
+
+  if(pf_open(p_path)) return 1;
+
+  if(pf_read(&p_vidplay->header, sizeof(p_vidplay->header), &len) || (len != sizeof(p_vidplay->header))) return 1;
+
+  if((p_vidplay->header.magic != VIDPLAY_MAGIC) || (p_vidplay->header.version != VIDPLAY_VERSION)) return 1;
+
+  if(!p_vidplay->header.width || (p_vidplay->header.width > XRES) || !p_vidplay->header.height || (p_vidplay->header.height > YRES)) return 1;
+
+  if(!p_vidplay->header.frames || !p_vidplay->header.first_sectors || (p_vidplay->header.first_sectors > p_vidplay->header.max_sectors)) return 1;
+
+  if(mapExtents(p_vidplay, p_fs)) return 1;
+
+  p_vidplay->p_buf[0] = malloc(p_vidplay->header.max_sectors * VIDPLAY_SECTOR);
+  p_vidplay->p_buf[1] = malloc(p_vidplay->header.max_sectors * VIDPLAY_SECTOR);
+
+  if(!p_vidplay->p_buf[0] || !p_vidplay->p_buf[1])
+  {
+    closeVidPlay(p_vidplay);
+
+    return 1;
+  }
+
+  p_vidplay->x = (XRES - p_vidplay->header.width) / 2;
+  p_vidplay->y = (YRES - p_vidplay->header.height) / 2;
+
+  p_vidplay->sector       = FIRST_RECORD;
+  p_vidplay->next_sectors = p_vidplay->header.first_sectors;
+
+  return 0;
+}
+
+// free the record buffers
+void closeVidPlay(struct s_vidplay *p_vidplay)
+{
+  if(!p_vidplay) return;
+
+  free(p_vidplay->p_buf[0]);
+  free(p_vidplay->p_buf[1]);
+
+  p_vidplay->p_buf[0] = NULL;
+  p_vidplay->p_buf[1] = NULL;
+}
+
+// show the next frame
+int stepVidPlay(struct s_vidplay *p_vidplay)
+{
+  uint32_t back = 0;
+
+  uint64_t now = 0;
+  uint64_t mark = 0;
+  uint64_t period = 0;
+
+  struct s_vidplay_frame *p_frame = NULL;
+
+  if(!p_vidplay) return 1;
+
+  if(!p_vidplay->p_buf[0]) return 1;
+
+  if(p_vidplay->next_sectors > p_vidplay->header.max_sectors) return 1;
+
+  mark = getClintMTime(p_vidplay->p_clint);
+
+  if(!p_vidplay->stats.frames) p_vidplay->stats.start = mark;
+
+  // the whole record in one go, the next one's size came with the last.
+  if(readSectors(p_vidplay, p_vidplay->sector, p_vidplay->next_sectors, (uint8_t *)p_vidplay->p_buf[p_vidplay->cur])) return 1;
+
+  p_frame = (struct s_vidplay_frame *)p_vidplay->p_buf[p_vidplay->cur];
+
+  if(sizeof(*p_frame) + p_frame->words * sizeof(uint32_t) > p_vidplay->next_sectors * VIDPLAY_SECTOR) return 1;
+
+  p_vidplay->stats.sectors += p_vidplay->next_sectors;
+
+  p_vidplay->sector      += p_vidplay->next_sectors;
+  p_vidplay->next_sectors = p_frame->next_sectors;
+
+  if(++p_vidplay->frame >= p_vidplay->header.frames)
+  {
+    p_vidplay->frame  = 0;
+    p_vidplay->sector = FIRST_RECORD;
+  }
+
+  now = getClintMTime(p_vidplay->p_clint);
+  p_vidplay->stats.io += now - mark;
+  mark = now;
+
+  back = getFbFlipBack();
+
+  if(!back) return 1;
+
+  now = getClintMTime(p_vidplay->p_clint);
+  p_vidplay->stats.wait += now - mark;
+  mark = now;
+
+  // the back buffer missed the last frame, a key frame covers it anyway.
+  if(p_vidplay->have_last && !(p_frame->flags & VIDPLAY_FRAME_KEY))
+  {
+    if(runOps(p_vidplay, back, (struct s_vidplay_frame *)p_vidplay->p_buf[p_vidplay->cur ^ 1])) return 1;
+  }
+
+  now = getClintMTime(p_vidplay->p_clint);
+  p_vidplay->stats.replay += now - mark;
+  mark = now;
+
+  if(runOps(p_vidplay, back, p_frame)) return 1;
+
+  now = getClintMTime(p_vidplay->p_clint);
+  p_vidplay->stats.decode += now - mark;
+  mark = now;
+
+  if(p_vidplay->due && (now < p_vidplay->due)) sleepClintTimer(p_vidplay->p_clint, p_vidplay->due - now);
+
+  if(submitFbFlip()) return 1;
+
+  now = getClintMTime(p_vidplay->p_clint);
+  p_vidplay->stats.wait += now - mark;
+
+  // keep the cadence when a little late, start it over when more than a frame behind.
+  period = calcMtimecmpMicroseconds(BUS_FREQ_HZ, p_vidplay->header.frame_us);
+
+  p_vidplay->due = ((p_vidplay->due && (now < p_vidplay->due + period)) ? p_vidplay->due + period : now + period);
+
+  p_vidplay->cur ^= 1;
+
+  p_vidplay->have_last = 1;
+
+  p_vidplay->stats.frames++;
+
+  p_vidplay->stats.total = now - p_vidplay->stats.start;
+
+  return 0;
+}
+
+// get the time breakdown
+struct s_vidplay_stats *getVidPlayStats(struct s_vidplay *p_vidplay)
+{
+  if(!p_vidplay) return NULL;
+
+  return &p_vidplay->stats;
+}
+
+// zero the stats
+void clrVidPlayStats(struct s_vidplay *p_vidplay)
+{
+  if(!p_vidplay) return;
+
+  memset(&p_vidplay->stats, 0, sizeof(p_vidplay->stats));
+}
+
+// print the sustained fps and time breakdown
+void printVidPlayStats(struct s_vidplay *p_vidplay)
+{
+  uint64_t total = 0;
+  uint32_t frames = 0;
+
+  struct s_vidplay_stats *p_stats = getVidPlayStats(p_vidplay);
+
+  if(!p_stats) return;
+
+  total  = (p_stats->total ? p_stats->total : 1);
+  frames = (p_stats->frames ? p_stats->frames : 1);
+
+  printf("\n\rVIDPLAY %lu FRAMES IN %lu MS, %lu.%02lu FPS, %lu KB/S\n\r",
+    (unsigned long)p_stats->frames,
+    (unsigned long)(total * 1000 / BUS_FREQ_HZ),
+    (unsigned long)((uint64_t)p_stats->frames * BUS_FREQ_HZ / total),
+    (unsigned long)((uint64_t)p_stats->frames * BUS_FREQ_HZ * 100 / total % 100),
+    (unsigned long)((uint64_t)p_stats->sectors * VIDPLAY_SECTOR * BUS_FREQ_HZ / 1024 / total));
+
+  printf("%-8s %10s %4s\n\r", "PHASE", "US/FRAME", "%");
+
+  printf("%-8s %10lu %4lu\n\r", "IO",     (unsigned long)(p_stats->io     * 1000000 / BUS_FREQ_HZ / frames), (unsigned long)(p_stats->io     * 100 / total));
+  printf("%-8s %10lu %4lu\n\r", "DECODE", (unsigned long)(p_stats->decode * 1000000 / BUS_FREQ_HZ / frames), (unsigned long)(p_stats->decode * 100 / total));
+  printf("%-8s %10lu %4lu\n\r", "REPLAY", (unsigned long)(p_stats->replay * 1000000 / BUS_FREQ_HZ / frames), (unsigned long)(p_stats->replay * 100 / total));
+  printf("%-8s %10lu %4lu\n\r", "WAIT",   (unsigned long)(p_stats->wait   * 1000000 / BUS_FREQ_HZ / frames), (unsigned long)(p_stats->wait   * 100 / total));
+}
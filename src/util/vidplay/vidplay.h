@@ -0,0 +1,389 @@
+/***************************************************************************//**
+  * @file     vidplay.h
+  * @brief    Frame sequence player for the AXI TFT
+  * @details  Streams run length and delta coded frames from a Petit FatFs file into fbflip back buffers.
+  * @author   Johnathan Convertino (johnathan.convertino.1@us.af.mil)
+  * @date     10/19/2026
+  * @version
+  * - 0.0.0
+  *
+  *
+  * @license mit
+  *
+  * Copyright 2026 Johnathan Convertino
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in
+  * all copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+  * IN THE SOFTWARE.
+  *****************************************************************************/
+
+#ifndef __VIDPLAY_H
+#define __VIDPLAY_H
+
+#include <stdint.h>
+
+#include <clint.h>
+#include <axi_tft.h>
+#include <pff3a/pff.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def VIDPLAY_MAGIC
+ * "VIDP" read as a little endian word.
+ */
+#define VIDPLAY_MAGIC         0x50444956
+
+/**
+ * @def VIDPLAY_VERSION
+ * container version this player reads.
+ */
+#define VIDPLAY_VERSION       1
+
+/**
+ * @def VIDPLAY_SECTOR
+ * file header and frame records are whole sectors, read without partial sector handling.
+ */
+#define VIDPLAY_SECTOR        512
+
+/**
+ * @def VIDPLAY_MAX_EXTENTS
+ * contiguous runs of sectors a file may be split into, a freshly copied file is one.
+ */
+#define VIDPLAY_MAX_EXTENTS   32
+
+/**
+ * @def VIDPLAY_FRAME_KEY
+ * frame flag, every pixel is filled or copied so older frames are not needed.
+ */
+#define VIDPLAY_FRAME_KEY     0x0001
+
+/**
+ * @def VIDPLAY_OP_SHIFT
+ * op type is the top two bits of an op word, the run length the rest.
+ */
+#define VIDPLAY_OP_SHIFT      30
+
+/**
+ * @def VIDPLAY_OP_COUNT_MASK
+ * run length in pixels.
+ */
+#define VIDPLAY_OP_COUNT_MASK 0x3FFFFFFF
+
+/**
+ * @def VIDPLAY_OP_SKIP
+ * leave count pixels as the last frame had them, may run over rows.
+ */
+#define VIDPLAY_OP_SKIP       0
+
+/**
+ * @def VIDPLAY_OP_FILL
+ * count pixels of the color in the next word, within one row.
+ */
+#define VIDPLAY_OP_FILL       1
+
+/**
+ * @def VIDPLAY_OP_COPY
+ * count pixels from the next count words, within one row.
+ */
+#define VIDPLAY_OP_COPY       2
+
+/**
+ * @struct s_vidplay_header
+ * @brief first sector of the file, little endian.
+ */
+struct s_vidplay_header
+{
+  /**
+   * @var s_vidplay_header::magic
+   * VIDPLAY_MAGIC
+   */
+  uint32_t magic;
+  /**
+   * @var s_vidplay_header::version
+   * VIDPLAY_VERSION
+   */
+  uint16_t version;
+  /**
+   * @var s_vidplay_header::width
+   * frame width, at most XRES.
+   */
+  uint16_t width;
+  /**
+   * @var s_vidplay_header::height
+   * frame height, at most YRES.
+   */
+  uint16_t height;
+  /**
+   * @var s_vidplay_header::first_sectors
+   * sectors in the first frame record.
+   */
+  uint16_t first_sectors;
+  /**
+   * @var s_vidplay_header::frames
+   * frame records after the header.
+   */
+  uint32_t frames;
+  /**
+   * @var s_vidplay_header::frame_us
+   * microseconds each frame is shown, 0 plays as fast as it decodes.
+   */
+  uint32_t frame_us;
+  /**
+   * @var s_vidplay_header::max_sectors
+   * sectors in the largest frame record, the read buffers are this big.
+   */
+  uint32_t max_sectors;
+};
+
+/**
+ * @struct s_vidplay_frame
+ * @brief start of each frame record, followed by the op words.
+ */
+struct s_vidplay_frame
+{
+  /**
+   * @var s_vidplay_frame::words
+   * op words after this header.
+   */
+  uint32_t words;
+  /**
+   * @var s_vidplay_frame::flags
+   * VIDPLAY_FRAME_KEY
+   */
+  uint16_t flags;
+  /**
+   * @var s_vidplay_frame::next_sectors
+   * sectors in the next record (the first after the last), so each frame is one read.
+   */
+  uint16_t next_sectors;
+};
+
+/**
+ * @struct s_vidplay_extent
+ * @brief contiguous sectors of the file on the card.
+ */
+struct s_vidplay_extent
+{
+  /**
+   * @var s_vidplay_extent::sector
+   * first card sector
+   */
+  uint32_t sector;
+  /**
+   * @var s_vidplay_extent::count
+   * sectors in the run
+   */
+  uint32_t count;
+};
+
+/**
+ * @struct s_vidplay_stats
+ * @brief where the time went, in mtime ticks since the last clear.
+ */
+struct s_vidplay_stats
+{
+  /**
+   * @var s_vidplay_stats::frames
+   * frames put on screen
+   */
+  uint32_t frames;
+  /**
+   * @var s_vidplay_stats::sectors
+   * sectors read
+   */
+  uint32_t sectors;
+  /**
+   * @var s_vidplay_stats::start
+   * mtime of the first frame
+   */
+  uint64_t start;
+  /**
+   * @var s_vidplay_stats::io
+   * reading frame records from the card
+   */
+  uint64_t io;
+  /**
+   * @var s_vidplay_stats::decode
+   * running the ops of the new frame
+   */
+  uint64_t decode;
+  /**
+   * @var s_vidplay_stats::replay
+   * running the ops of the last frame to bring the back buffer up to date
+   */
+  uint64_t replay;
+  /**
+   * @var s_vidplay_stats::wait
+   * waiting for a back buffer, vsync or the frame time
+   */
+  uint64_t wait;
+  /**
+   * @var s_vidplay_stats::total
+   * from start to the end of the last frame
+   */
+  uint64_t total;
+};
+
+/**
+ * @struct s_vidplay
+ * @brief open video state.
+ */
+struct s_vidplay
+{
+  /**
+   * @var s_vidplay::header
+   * file header
+   */
+  struct s_vidplay_header header;
+  /**
+   * @var s_vidplay::extents
+   * where the file is on the card, mapped once at open
+   */
+  struct s_vidplay_extent extents[VIDPLAY_MAX_EXTENTS];
+  /**
+   * @var s_vidplay::num_extents
+   * extents used
+   */
+  uint32_t num_extents;
+  /**
+   * @var s_vidplay::p_buf
+   * this frame's record and the last one's.
+   */
+  uint32_t *p_buf[2];
+  /**
+   * @var s_vidplay::cur
+   * p_buf index of this frame
+   */
+  uint8_t cur;
+  /**
+   * @var s_vidplay::have_last
+   * p_buf[cur ^ 1] holds the frame before.
+   */
+  uint8_t have_last;
+  /**
+   * @var s_vidplay::frame
+   * next frame to show
+   */
+  uint32_t frame;
+  /**
+   * @var s_vidplay::sector
+   * file sector of the next record
+   */
+  uint32_t sector;
+  /**
+   * @var s_vidplay::next_sectors
+   * sectors in the next record
+   */
+  uint32_t next_sectors;
+  /**
+   * @var s_vidplay::x
+   * left column of the video on the screen
+   */
+  uint32_t x;
+  /**
+   * @var s_vidplay::y
+   * top row of the video on the screen
+   */
+  uint32_t y;
+  /**
+   * @var s_vidplay::due
+   * mtime the next frame is due, 0 before the first.
+   */
+  uint64_t due;
+  /**
+   * @var s_vidplay::p_clint
+   * mtime for the stats and frame timing
+   */
+  struct s_clint *p_clint;
+  /**
+   * @var s_vidplay::stats
+   * time breakdown
+   */
+  struct s_vidplay_stats stats;
+};
+
+/*********************************************//**
+  * @brief open a video file. The file is mapped to
+  * card sectors once here, playing never touches the
+  * FAT. Two record buffers are allocated from the heap.
+  *
+  * @param p_vidplay video to open
+  * @param p_fs file system mounted with pf_mount.
+  * @param p_clint clint for mtime.
+  * @param p_path file to open.
+  *
+  * @return 0 on success, 1 on a bad file, a file split
+  * into more than VIDPLAY_MAX_EXTENTS pieces, or no memory.
+  *************************************************/
+int openVidPlay(struct s_vidplay *p_vidplay, FATFS *p_fs, struct s_clint *p_clint, const char *p_path);
+
+/*********************************************//**
+  * @brief free the record buffers.
+  *
+  * @param p_vidplay video to close
+  *************************************************/
+void closeVidPlay(struct s_vidplay *p_vidplay);
+
+/*********************************************//**
+  * @brief show the next frame. The record is read with
+  * multiple block reads, then the fbflip back buffer
+  * is brought up to date and the frame decoded into it,
+  * and it is submitted once the frame time is up. Plays
+  * from the start again after the last frame.
+  *
+  * Uses fbflip with 2 buffers, the back buffer is always
+  * two frames old and the last frame's ops catch it up.
+  *
+  * @param p_vidplay open video
+  *
+  * @return 0 on success, 1 on a read error or bad record.
+  *************************************************/
+int stepVidPlay(struct s_vidplay *p_vidplay);
+
+/*********************************************//**
+  * @brief get the time breakdown.
+  *
+  * @param p_vidplay open video
+  *
+  * @return stats, NULL for a bad pointer.
+  *************************************************/
+struct s_vidplay_stats *getVidPlayStats(struct s_vidplay *p_vidplay);
+
+/*********************************************//**
+  * @brief zero the stats, the next frame starts a new
+  * measurement.
+  *
+  * @param p_vidplay open video
+  *************************************************/
+void clrVidPlayStats(struct s_vidplay *p_vidplay);
+
+/*********************************************//**
+  * @brief print the sustained fps, card throughput and
+  * the share of io, decode, replay and wait with printf.
+  *
+  * @param p_vidplay open video
+  *************************************************/
+void printVidPlayStats(struct s_vidplay *p_vidplay);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
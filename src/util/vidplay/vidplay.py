@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+################################################################################
+### date      2026.10.19
+### author    Jay Convertino
+### brief     Encode a frame sequence into a vidplay container
+################################################################################
+#
+# usage
+#   ffmpeg -i splash.mp4 -vf scale=320:240 -r 15 frames/%04d.bmp
+#   vidplay.py --fps 15 splash.vid frames/*.bmp
+#
+# Frames are 24 or 32 bit uncompressed bmp or binary ppm files of one size, at
+# most the screen size. The first frame is a key frame, later frames only code
+# the pixels that changed from the frame before as runs of skip, fill and copy
+# ops. The header and every frame record are whole 512 byte sectors and each
+# record carries the size of the next, so the player reads one frame with one
+# multiple block read. Copy the file to a freshly formatted card so it is not
+# fragmented.
+
+import argparse
+import struct
+import sys
+
+VIDPLAY_MAGIC = 0x50444956
+VIDPLAY_VERSION = 1
+VIDPLAY_SECTOR = 512
+VIDPLAY_FRAME_KEY = 0x0001
+VIDPLAY_OP_SHIFT = 30
+VIDPLAY_OP_SKIP = 0
+VIDPLAY_OP_FILL = 1
+VIDPLAY_OP_COPY = 2
+VIDPLAY_OP_COUNT_MASK = 0x3FFFFFFF
+
+HEADER = struct.Struct("<IHHHHIII")
+FRAME = struct.Struct("<IHH")
+
+# a fill is two words, runs shorter than this are cheaper copied.
+MIN_FILL = 3
+# a skip and the copy op after it are two words, shorter unchanged runs are copied.
+MIN_SKIP = 3
+
+
+def read_bmp(data):
+    if data[:2] != b"BM":
+        return None
+    offset, = struct.unpack_from("<I", data, 10)
+    width, height, planes, bits, compression = struct.unpack_from("<iiHHI", data, 18)
+    if bits not in (24, 32) or compression not in (0, 3):
+        sys.exit("only 24 and 32 bit uncompressed bmp frames are supported")
+    step = bits // 8
+    stride = (width * step + 3) & ~3
+    rows = []
+    for row in range(abs(height)):
+        # bottom up unless the height is negative.
+        src = row if height < 0 else abs(height) - 1 - row
+        base = offset + src * stride
+        line = data[base:base + width * step]
+        rows.extend((line[i + 2] << 16) | (line[i + 1] << 8) | line[i] for i in range(0, width * step, step))
+    return width, abs(height), rows
+
+
+def read_ppm(data):
+    if data[:2] != b"P6":
+        return None
+    fields = []
+    pos = 2
+    while len(fields) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(int(data[pos:end]))
+        pos = end
+    width, height, maxval = fields
+    if maxval != 255:
+        sys.exit("only 8 bit ppm frames are supported")
+    pos += 1
+    pixels = data[pos:pos + width * height * 3]
+    return width, height, [(pixels[i] << 16) | (pixels[i + 1] << 8) | pixels[i + 2] for i in range(0, len(pixels), 3)]
+
+
+def read_frame(path):
+    data = open(path, "rb").read()
+    frame = read_bmp(data) or read_ppm(data)
+    if frame is None:
+        sys.exit(path + " is not a bmp or binary ppm file")
+    return frame
+
+
+def op(kind, count):
+    return (kind << VIDPLAY_OP_SHIFT) | count
+
+
+def encode(prev, cur, width, height):
+    """ops that turn prev into cur, every pixel is filled or copied when prev is None."""
+    words = []
+    skip = 0
+    for row in range(height):
+        base = row * width
+        x = 0
+        while x < width:
+            pos = base + x
+            if prev is not None and cur[pos] == prev[pos]:
+                # unchanged runs carry over row ends.
+                end = x
+                while end < width and cur[base + end] == prev[base + end]:
+                    end += 1
+                skip += end - x
+                x = end
+                continue
+            if skip:
+                words.append(op(VIDPLAY_OP_SKIP, skip))
+                skip = 0
+            end = x + 1
+            while end < width and cur[base + end] == cur[pos]:
+                end += 1
+            if end - x >= MIN_FILL:
+                words += [op(VIDPLAY_OP_FILL, end - x), cur[pos]]
+                x = end
+                continue
+            # literals up to the row end, a fill worth starting, or an unchanged run worth skipping.
+            end = x + 1
+            while end < width:
+                fill = end + 1
+                while fill < width and fill - end < MIN_FILL and cur[base + fill] == cur[base + end]:
+                    fill += 1
+                if fill - end >= MIN_FILL:
+                    break
+                if prev is not None:
+                    same = end
+                    while same < width and same - end < MIN_SKIP and cur[base + same] == prev[base + same]:
+                        same += 1
+                    if same - end >= MIN_SKIP:
+                        break
+                end += 1
+            words.append(op(VIDPLAY_OP_COPY, end - x))
+            words += cur[base + x:base + end]
+            x = end
+    # a trailing skip changes nothing and is dropped.
+    return words
+
+
+def decode(words, image, width, height):
+    """run ops over image the way the player does, for --verify."""
+    x = y = pos = 0
+    while pos < len(words):
+        kind, count = words[pos] >> VIDPLAY_OP_SHIFT, words[pos] & VIDPLAY_OP_COUNT_MASK
+        pos += 1
+        if kind == VIDPLAY_OP_SKIP:
+            x += count
+            y += x // width
+            x %= width
+            continue
+        assert x + count <= width and y < height, "run past the row end"
+        base = y * width + x
+        if kind == VIDPLAY_OP_FILL:
+            image[base:base + count] = [words[pos]] * count
+            pos += 1
+        elif kind == VIDPLAY_OP_COPY:
+            image[base:base + count] = words[pos:pos + count]
+            pos += count
+        else:
+            raise AssertionError("bad op")
+        x += count
+        if x == width:
+            x = 0
+            y += 1
+
+
+def sectors(size):
+    return (size + VIDPLAY_SECTOR - 1) // VIDPLAY_SECTOR
+
+
+def main():
+    parser = argparse.ArgumentParser(description="encode frames into a vidplay container")
+    parser.add_argument("out", help="container to write")
+    parser.add_argument("frames", nargs="+", help="bmp or ppm frames in order")
+    parser.add_argument("--fps", type=float, default=0, help="frames per second, 0 plays as fast as the card allows")
+    parser.add_argument("--key-every", type=int, default=0, help="also make every nth frame a key frame")
+    parser.add_argument("--screen", default="640x480", help="largest frame the player takes, XRESxYRES")
+    parser.add_argument("--verify", action="store_true", help="decode every frame again and compare")
+    args = parser.parse_args()
+
+    max_width, max_height = (int(v) for v in args.screen.split("x"))
+
+    records = []
+    prev = None
+    width = height = None
+    raw = 0
+    for index, path in enumerate(args.frames):
+        w, h, cur = read_frame(path)
+        if width is None:
+            width, height = w, h
+            if width > max_width or height > max_height:
+                sys.exit("frames are %dx%d, larger than the %s screen" % (width, height, args.screen))
+        elif (w, h) != (width, height):
+            sys.exit("%s is %dx%d, the first frame is %dx%d" % (path, w, h, width, height))
+        key = index == 0 or (args.key_every and index % args.key_every == 0)
+        words = encode(None if key else prev, cur, width, height)
+        if args.verify:
+            image = [0] * (width * height) if key else list(prev)
+            decode(words, image, width, height)
+            if image != cur:
+                sys.exit("verify failed at frame %d" % index)
+        records.append((VIDPLAY_FRAME_KEY if key else 0, words))
+        raw += width * height * 4
+        prev = cur
+
+    sizes = [sectors(FRAME.size + 4 * len(words)) for _, words in records]
+    if max(sizes) > 0xFFFF:
+        sys.exit("a frame record is over 65535 sectors")
+
+    frame_us = int(round(1000000 / args.fps)) if args.fps else 0
+
+    with open(args.out, "wb") as out:
+        out.write(HEADER.pack(VIDPLAY_MAGIC, VIDPLAY_VERSION, width, height, sizes[0], len(records), frame_us, max(sizes)).ljust(VIDPLAY_SECTOR, b"\0"))
+        for index, (flags, words) in enumerate(records):
+            # the last record points back at the first, the player loops.
+            record = FRAME.pack(len(words), flags, sizes[(index + 1) % len(records)]) + struct.pack("<%dI" % len(words), *words)
+            out.write(record.ljust(sizes[index] * VIDPLAY_SECTOR, b"\0"))
+
+    total = sum(sizes) * VIDPLAY_SECTOR
+    print("%d frames %dx%d, %d bytes, %.1f KB a frame, %.1f%% of raw" % (len(records), width, height, VIDPLAY_SECTOR + total, total / 1024 / len(records), 100.0 * total / raw))
+
+
+if __name__ == "__main__":
+    main()